@@ -14,15 +14,59 @@
 
 // --- Public types
 
+#ifdef RBUF_CFG_SIZE_32BIT
+typedef uint32_t RBUF_size_t; /*!< Host builds with rings above 64 KB */
+#else
 typedef uint16_t RBUF_size_t;
+#endif
 
-typedef struct RBUF_s
+typedef struct RBUF_s RBUF_t;
+
+typedef uint32_t (*RBUF_ClockFn_t)(void *context); /*!< Monotonic tick source, wraps */
+
+#define RBUF_HOOK_READY     0x01U /*!< ready_word attached */
+#define RBUF_HOOK_WATERMARK 0x02U /*!< watermark attached */
+#define RBUF_HOOK_MONITOR   0x04U /*!< monitor attached */
+#define RBUF_HOOK_LATENCY   0x08U /*!< latency attached */
+
+typedef enum RBUF_WatermarkEvent_e
+{
+  RBUF_WATERMARK_HIGH, /*!< Used size rose to high watermark */
+  RBUF_WATERMARK_LOW,  /*!< Used size fell to low watermark after a high event */
+} RBUF_WatermarkEvent_t;
+
+typedef void (*RBUF_WatermarkCb_t)(RBUF_t *buffer, RBUF_WatermarkEvent_t event, void *context);
+
+typedef struct RBUF_Watermark_s
 {
-  uint8_t *data;           /*!< Buffer data */
-  RBUF_size_t write_index; /*!< Write index */
-  RBUF_size_t read_index;  /*!< Read index */
-  RBUF_size_t size;        /*!< Buffer size */
-} RBUF_t;
+  RBUF_size_t high;            /*!< Used size firing RBUF_WATERMARK_HIGH */
+  RBUF_size_t low;             /*!< Used size firing RBUF_WATERMARK_LOW */
+  bool is_high;                /*!< High fired, waiting for low */
+  RBUF_WatermarkCb_t callback; /*!< Called on crossing */
+  void *context;               /*!< Passed to callback */
+} RBUF_Watermark_t;
+
+struct RBUF_s
+{
+  uint8_t *data;                /*!< Buffer data */
+  RBUF_size_t write_index;      /*!< Write index */
+  RBUF_size_t read_index;       /*!< Read index */
+  RBUF_size_t size;             /*!< Buffer size */
+  uint32_t *ready_word;         /*!< Readiness bitmap word of the owning ring set, NULL if none */
+  uint32_t ready_mask;          /*!< Readiness bit in ready_word */
+  RBUF_Watermark_t *watermark;  /*!< Watermarks, NULL if none */
+  struct RBUF_Monitor_s *monitor; /*!< State publication for snapshots, NULL if none */
+#ifdef RBUF_CFG_LATENCY
+  struct RBUF_Latency_s *latency; /*!< Residency measurement, NULL if none */
+#endif
+  uint8_t hooks;                /*!< RBUF_HOOK_* of attached hooks, one test on the notify path when none */
+};
+
+typedef struct RBUF_Span_s
+{
+  uint8_t *data;    /*!< Contiguous part of buffer data */
+  RBUF_size_t size; /*!< Span size */
+} RBUF_Span_t;
 
 // --- Public functions
 
@@ -33,7 +77,7 @@ typedef struct RBUF_s
  * \param size Buffer size
  * \details write_index = 0, read_index = 0
  */
-void RBUF_InitEmpty(RBUF_t *buffer, uint8_t *data, uint16_t size);
+void RBUF_InitEmpty(RBUF_t *buffer, uint8_t *data, RBUF_size_t size);
 
 /**
  * \brief Check for empty buffer
@@ -138,3 +182,89 @@ bool RBUF_ReadCopyBlock(BUF_t *buf_dst, RBUF_t *rbuf_src, RBUF_size_t size);
  * \return Size read
  */
 RBUF_size_t RBUF_ReadCopyRaw(BUF_t *buf_dst, RBUF_t *rbuf_src, RBUF_size_t size);
+
+/**
+ * \brief Get free space in place, to fill before RBUF_WriteCommit
+ * \param buffer Buffer to write to
+ * \param spans Free space from write index, second span used on rollover
+ * \return Free size
+ */
+RBUF_size_t RBUF_WriteReserve(const RBUF_t *buffer, RBUF_Span_t spans[2]);
+
+/**
+ * \brief Get readable data in place, to consume before RBUF_ReadCommit
+ * \param buffer Buffer to read from
+ * \param spans Data from read index, second span used on rollover
+ * \return Used size
+ */
+RBUF_size_t RBUF_ReadPeek(const RBUF_t *buffer, RBUF_Span_t spans[2]);
+
+/**
+ * \brief Publish bytes already stored in buffer data past write index
+ * \param buffer Buffer to commit to
+ * \param size Size to commit
+ * \return true if size was committed, false if greater than free space
+ * \details For writers filling buffer data in place, across rollover
+ */
+bool RBUF_WriteCommit(RBUF_t *buffer, RBUF_size_t size);
+
+/**
+ * \brief Release bytes consumed in place from buffer data
+ * \param buffer Buffer to commit to
+ * \param size Size to release
+ * \return true if size was released, false if greater than used space
+ */
+bool RBUF_ReadCommit(RBUF_t *buffer, RBUF_size_t size);
+
+/**
+ * \brief Update ring set readiness, watermarks and monitor after indexes were moved outside of this API
+ * \param buffer Buffer written to
+ */
+void RBUF_NotifyWrite(RBUF_t *buffer);
+
+/**
+ * \brief Update ring set readiness, watermarks and monitor after indexes were moved outside of this API
+ * \param buffer Buffer read from
+ */
+void RBUF_NotifyRead(RBUF_t *buffer);
+
+/**
+ * \brief Move readable data to the start of buffer data, in place
+ * \param buffer Buffer to linearize
+ * \return true if readable data is now buffer->data[0] to buffer->data[used size - 1], false on bad parameter
+ * \details Wrapped data is rotated in place by block swaps, O(size), with 64 bytes of stack
+ * instead of a scratch buffer. No concurrent write nor read.
+ */
+bool RBUF_Linearize(RBUF_t *buffer);
+
+/**
+ * \brief Move buffer content to new storage
+ * \param buffer Buffer to resize
+ * \param data New buffer data, must not overlap the current one
+ * \param size New buffer size
+ * \return true if resized, false if content or watermarks do not fit the new size or on bad parameter
+ * \details Readable data is copied once to the start of data. Current storage is left to the caller.
+ * No concurrent write nor read.
+ */
+bool RBUF_Resize(RBUF_t *buffer, uint8_t *data, RBUF_size_t size);
+
+/**
+ * \brief Watch used size with hysteresis
+ * \param buffer Buffer to watch
+ * \param watermark Watermark storage, must outlive the watch
+ * \param low Used size firing RBUF_WATERMARK_LOW once high was reached
+ * \param high Used size firing RBUF_WATERMARK_HIGH, from below
+ * \param callback Called from the write or read that crosses a watermark
+ * \param context Passed to callback
+ * \return true if set, false if low >= high, high >= size or bad parameter
+ * \details Each crossing fires once, the next event is the opposite one.
+ * A buffer already at or above high starts in the high state, without event.
+ */
+bool RBUF_SetWatermark(RBUF_t *buffer, RBUF_Watermark_t *watermark, RBUF_size_t low, RBUF_size_t high,
+                       RBUF_WatermarkCb_t callback, void *context);
+
+/**
+ * \brief Stop watching used size
+ * \param buffer Buffer to stop watching
+ */
+void RBUF_ClearWatermark(RBUF_t *buffer);
@@ -0,0 +1,127 @@
+/**
+ * \file ring_buffer_bcast.h
+ * \brief Broadcast Ring Buffer, single writer and multiple independent readers
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Data is stored once and every attached reader consumes it through its own
+ * read index. Free space is computed against the slowest reader.
+ *
+ * With RBUF_BCAST_BLOCK and RBUF_BCAST_EVICT, each read index is only
+ * written by its reader, so the writer and readers may run in different
+ * contexts like a regular ring. RBUF_BCAST_LAP is different: the writer
+ * moves the read index of a lapped reader. A read running at the same time
+ * would overwrite that move and then return data already overwritten. With
+ * this policy, RBUF_BcastWriteString and RBUF_BcastReadCopyRaw must run
+ * serialized: in one context, or under a lock shared by the writer and all
+ * readers.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "buffer/buffer.h"
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#ifndef RBUF_BCAST_READER_MAX
+#define RBUF_BCAST_READER_MAX 4U /*!< Up to 32 */
+#endif
+
+// --- Public types
+
+typedef enum RBUF_BcastPolicy_e
+{
+  RBUF_BCAST_BLOCK, /*!< Write fails when the slowest reader has no room */
+  RBUF_BCAST_EVICT, /*!< Readers without room are detached */
+  RBUF_BCAST_LAP,   /*!< Readers without room lose their oldest data, writer and readers serialized */
+} RBUF_BcastPolicy_t;
+
+typedef struct RBUF_Bcast_s
+{
+  RBUF_t ring;                                   /*!< Storage and write index */
+  RBUF_size_t read_index[RBUF_BCAST_READER_MAX]; /*!< Read index per reader */
+  uint32_t lost_size[RBUF_BCAST_READER_MAX];     /*!< Bytes skipped per reader when lapped */
+  uint32_t reader_mask;                          /*!< Attached readers */
+  RBUF_BcastPolicy_t policy;                     /*!< Slow reader policy */
+} RBUF_Bcast_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize empty broadcast buffer, no reader attached
+ * \param bcast Broadcast buffer to initialize
+ * \param data Buffer data
+ * \param size Buffer size
+ * \param policy Slow reader policy
+ */
+void RBUF_BcastInit(RBUF_Bcast_t *bcast, uint8_t *data, RBUF_size_t size, RBUF_BcastPolicy_t policy);
+
+/**
+ * \brief Attach a reader, it receives data written from now on
+ * \param bcast Broadcast buffer
+ * \param reader Reader id
+ * \return true if reader was attached, false if none is available
+ */
+bool RBUF_BcastAttach(RBUF_Bcast_t *bcast, uint8_t *reader);
+
+/**
+ * \brief Detach a reader
+ * \param bcast Broadcast buffer
+ * \param reader Reader id
+ */
+void RBUF_BcastDetach(RBUF_Bcast_t *bcast, uint8_t reader);
+
+/**
+ * \brief Check reader is attached
+ * \param bcast Broadcast buffer
+ * \param reader Reader id
+ * \return true if attached, false if never attached, detached or evicted
+ */
+bool RBUF_BcastIsAttached(const RBUF_Bcast_t *bcast, uint8_t reader);
+
+/**
+ * \brief Get free space, limited by the slowest reader
+ * \param bcast Broadcast buffer
+ * \return Free space
+ */
+RBUF_size_t RBUF_BcastGetFreeSize(const RBUF_Bcast_t *bcast);
+
+/**
+ * \brief Get data left to read by a reader
+ * \param bcast Broadcast buffer
+ * \param reader Reader id
+ * \return Used space seen by reader
+ */
+RBUF_size_t RBUF_BcastGetUsedSize(const RBUF_Bcast_t *bcast, uint8_t reader);
+
+/**
+ * \brief Get bytes a reader lost by being lapped
+ * \param bcast Broadcast buffer
+ * \param reader Reader id
+ * \return Lost size since attach
+ */
+uint32_t RBUF_BcastGetLostSize(const RBUF_Bcast_t *bcast, uint8_t reader);
+
+/**
+ * \brief Write string once for all readers
+ * \param bcast Broadcast buffer
+ * \param data String to write
+ * \param size Size of string to write
+ * \return true if data was written, false otherwise
+ * \details Readers without room are handled according to the policy
+ */
+bool RBUF_BcastWriteString(RBUF_Bcast_t *bcast, const char *data, RBUF_size_t size);
+
+/**
+ * \brief Read request size for a reader, if not possible return what can be read
+ * \param buf_dst Destination buffer
+ * \param bcast Broadcast buffer
+ * \param reader Reader id
+ * \param size Size to read
+ * \return Size read
+ */
+RBUF_size_t RBUF_BcastReadCopyRaw(BUF_t *buf_dst, RBUF_Bcast_t *bcast, uint8_t reader, RBUF_size_t size);
@@ -0,0 +1,59 @@
+/**
+ * \file ring_buffer_bulk.h
+ * \brief Large block copies between Ring Buffer and linear buffers
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Transfers from RBUF_BULK_THRESHOLD bytes use non-temporal stores with
+ * software prefetch, so ring sized chunks do not evict the working set of
+ * other code from cache. The copy kernel is picked at run time from CPU
+ * features, plain memcpy where none applies. Smaller transfers take the
+ * regular RBUF_WriteCopy and RBUF_ReadCopyBlock path.
+ * Meant for data streaming through more ring storage than the cache holds:
+ * the copy itself is slower than a cached memcpy, the gain is for the code
+ * running next to it.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "buffer/buffer.h"
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#ifndef RBUF_BULK_THRESHOLD
+#define RBUF_BULK_THRESHOLD 16384U /*!< Smallest transfer using the bulk path, about half a L1 + L2 share */
+#endif
+
+// --- Public functions
+
+/**
+ * \brief Copy without polluting the cache
+ * \param dst Destination
+ * \param src Source, not overlapping dst
+ * \param size Size to copy
+ * \details Stores are fenced on return, data is visible to other cores
+ */
+void RBUF_BulkCopy(void *dst, const void *src, size_t size);
+
+/**
+ * \brief RBUF_WriteCopy with the bulk path for large transfers
+ * \param rbuf_dst Destination ring
+ * \param buf_src Source buffer
+ * \param size Size to copy
+ * \return true if data was written, false otherwise
+ */
+bool RBUF_BulkWriteCopy(RBUF_t *rbuf_dst, BUF_t *buf_src, RBUF_size_t size);
+
+/**
+ * \brief RBUF_ReadCopyBlock with the bulk path for large transfers
+ * \param buf_dst Destination buffer
+ * \param rbuf_src Source ring
+ * \param size Size to copy
+ * \return true if data was read, false otherwise
+ */
+bool RBUF_BulkReadCopyBlock(BUF_t *buf_dst, RBUF_t *rbuf_src, RBUF_size_t size);
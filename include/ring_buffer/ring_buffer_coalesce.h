@@ -0,0 +1,109 @@
+/**
+ * \file ring_buffer_coalesce.h
+ * \brief Coalescing writer batching small writes into one Ring Buffer publication
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Bytes are staged in ring storage past the published write index, invisible
+ * to the reader, and committed at once when the staged size reaches the
+ * threshold, when the oldest staged byte is older than the delay, or on
+ * flush. Ring set readiness, watermarks and monitor then fire once per batch
+ * instead of once per write.
+ * The delay is checked on each write and on RBUF_CoalescePoll, call it from
+ * the producer idle loop or tick so a quiet producer does not hold data:
+ * added latency is at most the delay plus the poll period.
+ * The writer owns the ring write side, mixing in regular writes between
+ * flushes would overwrite staged bytes.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public types
+
+typedef struct RBUF_Coalesce_s
+{
+  RBUF_t *ring;          /*!< Destination ring */
+  RBUF_size_t staged;    /*!< Bytes staged past the ring write index */
+  RBUF_size_t threshold; /*!< Staged size triggering a publication, 1 to publish every write */
+  uint32_t delay;        /*!< Clock ticks a byte may stay staged */
+  uint32_t staged_time;  /*!< Clock when the first staged byte was written */
+  RBUF_ClockFn_t clock;  /*!< Time source, NULL to only publish on threshold and flush */
+  void *context;         /*!< Passed to clock */
+  uint32_t writes;       /*!< Writes accepted since init */
+  uint32_t commits;      /*!< Publications since init */
+} RBUF_Coalesce_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize coalescing writer
+ * \param coalesce Writer to initialize
+ * \param ring Destination ring, its write side is owned by the writer
+ * \param threshold Staged size triggering a publication, 0 or 1 for no coalescing
+ * \param delay Clock ticks before staged bytes are published, 0 to publish every write
+ * \param clock Time source, NULL to disable the delay
+ * \param context Passed to clock
+ */
+void RBUF_CoalesceInit(RBUF_Coalesce_t *coalesce, RBUF_t *ring, RBUF_size_t threshold, uint32_t delay,
+                       RBUF_ClockFn_t clock, void *context);
+
+/**
+ * \brief Stage uint8_t
+ * \param coalesce Writer
+ * \param data Data to write
+ * \return true if data was staged, false if the ring is full
+ * \details Without room, staged bytes are published so the reader can drain the ring
+ */
+bool RBUF_CoalesceWriteUint8(RBUF_Coalesce_t *coalesce, uint8_t data);
+
+/**
+ * \brief Stage uint16_t, big endian as RBUF_WriteUint16
+ * \param coalesce Writer
+ * \param data Data to write
+ * \return true if data was staged, false if the ring is full
+ */
+bool RBUF_CoalesceWriteUint16(RBUF_Coalesce_t *coalesce, uint16_t data);
+
+/**
+ * \brief Stage uint32_t, big endian as RBUF_WriteUint32
+ * \param coalesce Writer
+ * \param data Data to write
+ * \return true if data was staged, false if the ring is full
+ */
+bool RBUF_CoalesceWriteUint32(RBUF_Coalesce_t *coalesce, uint32_t data);
+
+/**
+ * \brief Stage string
+ * \param coalesce Writer
+ * \param data String to write
+ * \param size Size of string to write
+ * \return true if the whole string was staged, false if the ring has no room for it
+ */
+bool RBUF_CoalesceWriteString(RBUF_Coalesce_t *coalesce, const char *data, RBUF_size_t size);
+
+/**
+ * \brief Publish staged bytes if the delay elapsed
+ * \param coalesce Writer
+ * \return true if bytes were published, false otherwise
+ */
+bool RBUF_CoalescePoll(RBUF_Coalesce_t *coalesce);
+
+/**
+ * \brief Publish staged bytes now
+ * \param coalesce Writer
+ * \return true if bytes were published, false if nothing was staged, no room or bad parameter
+ * \details Staged bytes are kept when the commit is refused
+ */
+bool RBUF_CoalesceFlush(RBUF_Coalesce_t *coalesce);
+
+/**
+ * \brief Get bytes staged, not yet visible to the reader
+ * \param coalesce Writer
+ * \return Staged size
+ */
+RBUF_size_t RBUF_CoalesceGetStagedSize(const RBUF_Coalesce_t *coalesce);
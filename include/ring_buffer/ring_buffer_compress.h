@@ -0,0 +1,89 @@
+/**
+ * \file ring_buffer_compress.h
+ * \brief Compressing writer and decompressing reader over a Ring Buffer
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Written bytes are staged in a caller provided block, delta coded against
+ * the byte one frame (stride) earlier and run length encoded into the ring.
+ * The ring then holds a plain byte stream of compressed blocks that the
+ * regular read functions can forward as is.
+ *
+ * Block format:
+ * - raw size, 2 bytes big endian
+ * - encoded size, 2 bytes big endian
+ * - tokens: control byte c
+ *   - c & 0x80: run of (c & 0x7F) + 3 copies of the next byte
+ *   - c & 0x40: (c & 0x3F) + 1 zeros then the next byte, the common case of a frame where one field changed
+ *   - otherwise: (c & 0x3F) + 1 literal bytes follow
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "buffer/buffer.h"
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_COMPRESS_HEADER_SIZE 4U
+#define RBUF_COMPRESS_BLOCK_MAX   32768U /*!< Keeps encoded size below 64 KB */
+
+/**
+ * \brief Worst case ring space taken by a block of raw_size bytes
+ */
+#define RBUF_COMPRESS_BOUND(raw_size) (RBUF_COMPRESS_HEADER_SIZE + (raw_size) + (((raw_size) + 63U) / 64U))
+
+// --- Public types
+
+typedef struct RBUF_Compress_s
+{
+  RBUF_t *ring;             /*!< Destination ring, holds compressed blocks */
+  uint8_t *block;           /*!< Raw bytes staging */
+  uint16_t block_size;      /*!< Staging size, raw size of a full block */
+  uint16_t block_used;      /*!< Raw bytes staged */
+  uint8_t stride;           /*!< Delta distance, frame length (1 for previous byte) */
+  uint32_t raw_size;        /*!< Raw bytes emitted since init */
+  uint32_t compressed_size; /*!< Ring bytes written since init */
+} RBUF_Compress_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize compressing writer
+ * \param compress Writer to initialize
+ * \param ring Destination ring
+ * \param block Staging storage
+ * \param block_size Staging size, up to RBUF_COMPRESS_BLOCK_MAX
+ * \param stride Delta distance, use the frame length for repetitive frames
+ */
+void RBUF_CompressInit(RBUF_Compress_t *compress, RBUF_t *ring, uint8_t *block, uint16_t block_size, uint8_t stride);
+
+/**
+ * \brief Write bytes, full blocks are compressed into the ring
+ * \param compress Writer
+ * \param data Data to write
+ * \param size Size to write
+ * \return Size accepted, lower than size when a full block has no room in the ring
+ */
+RBUF_size_t RBUF_CompressWrite(RBUF_Compress_t *compress, const uint8_t *data, RBUF_size_t size);
+
+/**
+ * \brief Compress staged bytes into the ring as a short block
+ * \param compress Writer
+ * \return true if nothing was staged or the block was written, false if the ring is full
+ */
+bool RBUF_CompressFlush(RBUF_Compress_t *compress);
+
+/**
+ * \brief Decompress the next complete block
+ * \param buf_dst Destination buffer
+ * \param rbuf_src Ring holding compressed blocks
+ * \param stride Delta distance used by the writer
+ * \return true if a block was decompressed, false if no complete block, no room in buf_dst or corrupted block
+ * \details A corrupted block, or one larger than buf_dst size, is dropped from the ring, buf_dst is left unchanged.
+ * A header with impossible sizes drops the whole ring content, the next block start cannot be found.
+ */
+bool RBUF_DecompressRead(BUF_t *buf_dst, RBUF_t *rbuf_src, uint8_t stride);
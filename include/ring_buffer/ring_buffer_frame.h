@@ -0,0 +1,92 @@
+/**
+ * \file ring_buffer_frame.h
+ * \brief COBS and SLIP framing over Ring Buffer storage
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Decoders look for the frame delimiter in the readable region of the ring,
+ * across rollover, and decode a complete frame straight from ring storage
+ * into the destination buffer. Runs of plain bytes are copied as blocks
+ * instead of byte per byte. Encoders write into the ring free region and
+ * publish the frame with one commit, the reader never sees part of a frame.
+ *
+ * - COBS: zero free encoding, 0x00 delimiter, overhead 1 byte per 254
+ * - SLIP (RFC 1055): 0xC0 delimiter, 0xC0 and 0xDB escaped with 0xDB
+ *
+ * Empty frames, such as a leading delimiter flushing line noise, are skipped.
+ * A full ring holding no delimiter can never complete a frame: its readable
+ * region is dropped and RBUF_FRAME_OVERSIZE returned, so the stream resumes
+ * at the next delimiter instead of stalling.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "buffer/buffer.h"
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_COBS_DELIMITER 0x00U
+#define RBUF_SLIP_END       0xC0U
+#define RBUF_SLIP_ESC       0xDBU
+#define RBUF_SLIP_ESC_END   0xDCU
+#define RBUF_SLIP_ESC_ESC   0xDDU
+
+/**
+ * \brief Worst case ring space taken by a COBS frame of size bytes, delimiter included
+ */
+#define RBUF_COBS_BOUND(size) ((size) + ((size) / 254U) + 2U)
+
+/**
+ * \brief Worst case ring space taken by a SLIP frame of size bytes, delimiter included
+ */
+#define RBUF_SLIP_BOUND(size) ((2U * (size)) + 1U)
+
+// --- Public types
+
+typedef enum RBUF_FrameStatus_e
+{
+  RBUF_FRAME_DECODED,    /*!< Frame decoded into destination */
+  RBUF_FRAME_INCOMPLETE, /*!< No delimiter yet, nothing consumed, or bad parameter */
+  RBUF_FRAME_CORRUPTED,  /*!< Invalid encoding, frame dropped */
+  RBUF_FRAME_OVERSIZE,   /*!< Frame larger than destination free space or ring size, frame dropped */
+} RBUF_FrameStatus_t;
+
+// --- Public functions
+
+/**
+ * \brief Decode next COBS frame
+ * \param buf_dst Destination buffer, sized for the largest frame
+ * \param rbuf_src Ring holding encoded frames
+ * \return Decode status, buf_dst is only written on RBUF_FRAME_DECODED
+ */
+RBUF_FrameStatus_t RBUF_CobsDecode(BUF_t *buf_dst, RBUF_t *rbuf_src);
+
+/**
+ * \brief Encode frame with COBS into ring
+ * \param rbuf_dst Destination ring
+ * \param data Frame to encode
+ * \param size Frame size
+ * \return true if written, false if free space is below RBUF_COBS_BOUND(size) or bad parameter
+ */
+bool RBUF_CobsEncode(RBUF_t *rbuf_dst, const uint8_t *data, RBUF_size_t size);
+
+/**
+ * \brief Decode next SLIP frame
+ * \param buf_dst Destination buffer, sized for the largest frame
+ * \param rbuf_src Ring holding encoded frames
+ * \return Decode status, buf_dst is only written on RBUF_FRAME_DECODED
+ */
+RBUF_FrameStatus_t RBUF_SlipDecode(BUF_t *buf_dst, RBUF_t *rbuf_src);
+
+/**
+ * \brief Encode frame with SLIP into ring
+ * \param rbuf_dst Destination ring
+ * \param data Frame to encode
+ * \param size Frame size
+ * \return true if written, false if free space is below RBUF_SLIP_BOUND(size) or bad parameter
+ */
+bool RBUF_SlipEncode(RBUF_t *rbuf_dst, const uint8_t *data, RBUF_size_t size);
@@ -0,0 +1,78 @@
+/**
+ * \file ring_buffer_history.h
+ * \brief Sample history ring with contiguous newest window, FIR and dot product kernels
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Storage holds every sample twice, capacity apart, so the newest samples
+ * are always contiguous and a filter runs on them without modulo or copy.
+ * Kernels use AVX, SSE or NEON when the compiler targets them, scalar code
+ * otherwise.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_HISTORY_STORAGE_SIZE(capacity) (2U * (capacity)) /*!< Storage entries for capacity samples */
+
+// --- Public types
+
+typedef struct RBUF_History_s
+{
+  float *data;          /*!< Mirrored storage, RBUF_HISTORY_STORAGE_SIZE(capacity) entries */
+  RBUF_size_t capacity; /*!< Longest window */
+  RBUF_size_t index;    /*!< Next sample slot */
+  RBUF_size_t count;    /*!< Number of samples, up to capacity */
+} RBUF_History_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize empty history
+ * \param history History to initialize
+ * \param data Storage, RBUF_HISTORY_STORAGE_SIZE(capacity) entries
+ * \param capacity Longest window, up to half RBUF_size_t range
+ */
+void RBUF_HistoryInit(RBUF_History_t *history, float *data, RBUF_size_t capacity);
+
+/**
+ * \brief Push sample, overwriting the oldest one when full
+ * \param history History to push to
+ * \param sample Sample to push
+ * \return true if pushed, false otherwise
+ */
+bool RBUF_HistoryPush(RBUF_History_t *history, float sample);
+
+/**
+ * \brief Get the newest samples as a contiguous window
+ * \param history History to check
+ * \param length Window length
+ * \return Window, oldest sample first, NULL if fewer than length samples
+ * \details Window stays valid until length more samples are pushed
+ */
+const float *RBUF_HistoryGetWindow(const RBUF_History_t *history, RBUF_size_t length);
+
+/**
+ * \brief Filter the newest samples
+ * \param history History to filter
+ * \param taps Coefficients in time order, taps[tap_count - 1] weights the newest sample
+ * \param tap_count Number of coefficients
+ * \param output Filter output
+ * \return true if filtered, false if fewer than tap_count samples
+ */
+bool RBUF_HistoryFir(const RBUF_History_t *history, const float *taps, RBUF_size_t tap_count, float *output);
+
+/**
+ * \brief Dot product
+ * \param a First vector
+ * \param b Second vector
+ * \param length Vectors length
+ * \return Sum of a[i] * b[i], 0 on bad input
+ */
+float RBUF_HistoryDot(const float *a, const float *b, RBUF_size_t length);
@@ -0,0 +1,78 @@
+/**
+ * \file ring_buffer_host.h
+ * \brief Ring Buffer storage on huge pages bound to a NUMA node, Linux hosts
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Storage is mapped with explicit huge pages when reserved, else with
+ * transparent huge pages on a 2 MB aligned range, else with regular pages.
+ * It is bound to a NUMA node before being touched, so every page comes from
+ * that node. Each step degrades gracefully and the result is reported.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_HOST_HUGE_PAGE_SIZE (2UL * 1024UL * 1024UL)
+#define RBUF_HOST_NODE_NONE      (-1) /*!< No NUMA binding */
+#define RBUF_HOST_NODE_CURRENT   (-2) /*!< Node of the calling thread, call from the consumer */
+
+// --- Public types
+
+typedef enum RBUF_HostPages_e
+{
+  RBUF_HOST_PAGES_DEFAULT, /*!< Regular pages */
+  RBUF_HOST_PAGES_THP,     /*!< Transparent huge pages (madvise) */
+  RBUF_HOST_PAGES_HUGE,    /*!< Explicit huge pages (MAP_HUGETLB), falls back to RBUF_HOST_PAGES_THP */
+} RBUF_HostPages_t;
+
+typedef struct RBUF_HostMem_s
+{
+  void *base;             /*!< Storage */
+  size_t map_size;        /*!< Mapped size, multiple of the page size used */
+  RBUF_HostPages_t pages; /*!< Pages actually obtained */
+  int node;               /*!< Node storage is bound to, RBUF_HOST_NODE_NONE if not bound */
+} RBUF_HostMem_t;
+
+// --- Public functions
+
+/**
+ * \brief Get NUMA node of the calling thread
+ * \return Node, 0 if unknown
+ */
+int RBUF_HostGetCurrentNode(void);
+
+/**
+ * \brief Map storage, prefaulted
+ * \param mem Storage handle to initialize
+ * \param size Storage size
+ * \param pages Pages requested
+ * \param node NUMA node, RBUF_HOST_NODE_CURRENT or RBUF_HOST_NODE_NONE
+ * \return true if storage was mapped, false otherwise
+ * \details Binding is a preference, pages come from another node when the requested one is exhausted
+ */
+bool RBUF_HostAlloc(RBUF_HostMem_t *mem, size_t size, RBUF_HostPages_t pages, int node);
+
+/**
+ * \brief Unmap storage
+ * \param mem Storage handle
+ */
+void RBUF_HostFree(RBUF_HostMem_t *mem);
+
+/**
+ * \brief Map storage and initialize an empty ring on it
+ * \param buffer Ring to initialize
+ * \param mem Storage handle to initialize, release with RBUF_HostFree
+ * \param size Ring size
+ * \param pages Pages requested
+ * \param node NUMA node, RBUF_HOST_NODE_CURRENT or RBUF_HOST_NODE_NONE
+ * \return true if ring was created, false otherwise
+ */
+bool RBUF_HostCreate(RBUF_t *buffer, RBUF_HostMem_t *mem, RBUF_size_t size, RBUF_HostPages_t pages, int node);
@@ -0,0 +1,134 @@
+/**
+ * \file ring_buffer_latency.h
+ * \brief Ring Buffer residency time measurement, built with RBUF_CFG_LATENCY
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Writes timestamp one byte every period bytes, or the first byte of every
+ * write for record oriented rings. When a read consumes a sampled byte its
+ * residency time goes to a log-linear histogram: 2^RBUF_LATENCY_SUB_BITS
+ * linear buckets per power of two, so each bucket is within
+ * 1 / 2^RBUF_LATENCY_SUB_BITS of its values.
+ * A write takes at most one sample, a read records at most the samples it
+ * consumed. Without RBUF_CFG_LATENCY nothing is added to RBUF_t nor to its
+ * write and read paths.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#ifndef RBUF_LATENCY_SUB_BITS
+#define RBUF_LATENCY_SUB_BITS 3U
+#endif
+
+#define RBUF_LATENCY_BUCKET_COUNT ((33U - RBUF_LATENCY_SUB_BITS) << RBUF_LATENCY_SUB_BITS)
+#define RBUF_LATENCY_PER_WRITE    0U /*!< Period sampling the first byte of every write */
+
+// --- Public types
+
+typedef struct RBUF_LatencySample_s
+{
+  uint32_t position; /*!< Sampled byte, count of bytes written before it */
+  uint32_t time;     /*!< Clock when written */
+} RBUF_LatencySample_t;
+
+typedef struct RBUF_LatencySummary_s
+{
+  uint32_t count; /*!< Samples recorded */
+  uint32_t p50;   /*!< Median residency */
+  uint32_t p99;   /*!< 99th percentile residency */
+  uint32_t max;   /*!< Longest residency */
+} RBUF_LatencySummary_t;
+
+typedef struct RBUF_Latency_s
+{
+  RBUF_ClockFn_t clock;                        /*!< Time source, any monotonic tick */
+  void *context;                               /*!< Passed to clock */
+  uint32_t period;                             /*!< Bytes between samples, RBUF_LATENCY_PER_WRITE for records */
+  uint32_t written;                            /*!< Bytes written since attach */
+  uint32_t read;                               /*!< Bytes read since attach */
+  uint32_t next_sample;                        /*!< Position of next sampled byte */
+  RBUF_size_t write_index;                     /*!< Ring write index last seen */
+  RBUF_size_t read_index;                      /*!< Ring read index last seen */
+  RBUF_LatencySample_t *samples;               /*!< Samples in flight, FIFO */
+  uint16_t sample_capacity;                    /*!< FIFO size */
+  uint16_t sample_head;                        /*!< Oldest sample */
+  uint16_t sample_count;                       /*!< Samples in flight */
+  uint32_t dropped;                            /*!< Samples not taken, FIFO full */
+  uint32_t count;                              /*!< Samples recorded */
+  uint32_t max;                                /*!< Longest residency */
+  uint32_t buckets[RBUF_LATENCY_BUCKET_COUNT]; /*!< Histogram */
+} RBUF_Latency_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize measurement
+ * \param latency Measurement to initialize
+ * \param samples Storage for samples in flight, about ring size / period entries
+ * \param sample_capacity Number of entries
+ * \param period Bytes between samples, RBUF_LATENCY_PER_WRITE for one sample per write
+ * \param clock Time source
+ * \param context Passed to clock
+ */
+void RBUF_LatencyInit(RBUF_Latency_t *latency, RBUF_LatencySample_t *samples, uint16_t sample_capacity,
+                      uint32_t period, RBUF_ClockFn_t clock, void *context);
+
+/**
+ * \brief Start measuring a ring, data already in it is not sampled
+ * \param buffer Ring to measure
+ * \param latency Initialized measurement
+ * \return true if attached, false otherwise
+ */
+bool RBUF_LatencyAttach(RBUF_t *buffer, RBUF_Latency_t *latency);
+
+/**
+ * \brief Stop measuring a ring, histogram is kept
+ * \param buffer Measured ring
+ */
+void RBUF_LatencyDetach(RBUF_t *buffer);
+
+/**
+ * \brief Clear histogram, samples in flight are kept
+ * \param latency Measurement
+ */
+void RBUF_LatencyReset(RBUF_Latency_t *latency);
+
+/**
+ * \brief Get residency at a quantile
+ * \param latency Measurement
+ * \param per_mille Quantile, 500 for median, 999 for p99.9
+ * \return Highest value of the bucket holding the quantile, capped to max, 0 without sample
+ */
+uint32_t RBUF_LatencyGetQuantile(const RBUF_Latency_t *latency, uint16_t per_mille);
+
+/**
+ * \brief Export count, p50, p99 and max
+ * \param latency Measurement
+ * \param summary Exported values
+ */
+void RBUF_LatencyGetSummary(const RBUF_Latency_t *latency, RBUF_LatencySummary_t *summary);
+
+/**
+ * \brief Account bytes written, called by the ring write paths
+ * \param buffer Measured ring
+ */
+void RBUF_LatencyOnWrite(RBUF_t *buffer);
+
+/**
+ * \brief Account bytes read, called by the ring read paths
+ * \param buffer Measured ring
+ */
+void RBUF_LatencyOnRead(RBUF_t *buffer);
+
+/**
+ * \brief Follow indexes moved without data transfer, called by ring linearize and resize
+ * \param buffer Measured ring
+ */
+void RBUF_LatencyOnMove(RBUF_t *buffer);
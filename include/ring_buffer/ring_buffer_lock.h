@@ -0,0 +1,183 @@
+/**
+ * \file ring_buffer_lock.h
+ * \brief Ring Buffer with a concurrency policy chosen at init
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * One writer context and one reader context, for instance an interrupt and
+ * a task, share the ring. Each side takes the lock only to snapshot the
+ * indexes and to publish its own index, data is copied outside the lock on
+ * a private view of the ring. The critical section is a few loads and
+ * stores, whatever the transfer size, plus the ring set, watermark and
+ * monitor notifications of the published index. Watermark callbacks thus
+ * run inside the critical section and must not call RBUF_Locked functions.
+ * Several writers, or several readers, must still be serialized by the
+ * caller.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "buffer/buffer.h"
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public types
+
+typedef void (*RBUF_LockFn_t)(void *context);
+
+typedef struct RBUF_Lock_s
+{
+  RBUF_LockFn_t enter; /*!< Enter critical section, NULL for none */
+  RBUF_LockFn_t exit;  /*!< Exit critical section, NULL for none */
+  void *context;       /*!< Passed to enter and exit */
+} RBUF_Lock_t;
+
+typedef struct RBUF_Spinlock_s
+{
+  uint32_t flag; /*!< 1 when held */
+} RBUF_Spinlock_t;
+
+typedef struct RBUF_Locked_s
+{
+  RBUF_t ring;      /*!< Shared ring */
+  RBUF_Lock_t lock; /*!< Concurrency policy */
+} RBUF_Locked_t;
+
+// --- Public functions
+
+/**
+ * \brief Policy without lock, for a ring used from a single context
+ * \param lock Policy to initialize
+ */
+void RBUF_LockInitNone(RBUF_Lock_t *lock);
+
+/**
+ * \brief Policy with user critical section hooks, for instance interrupt disable and restore
+ * \param lock Policy to initialize
+ * \param enter Enter critical section
+ * \param exit Exit critical section
+ * \param context Passed to hooks
+ */
+void RBUF_LockInitHooks(RBUF_Lock_t *lock, RBUF_LockFn_t enter, RBUF_LockFn_t exit, void *context);
+
+/**
+ * \brief Policy with a spinlock, for contexts running on different cores
+ * \param lock Policy to initialize
+ * \param spinlock Spinlock, released by this function
+ */
+void RBUF_LockInitSpin(RBUF_Lock_t *lock, RBUF_Spinlock_t *spinlock);
+
+/**
+ * \brief Initialize empty ring with a concurrency policy
+ * \param locked Ring to initialize
+ * \param data Ring storage
+ * \param size Ring storage size
+ * \param lock Policy, copied
+ */
+void RBUF_LockedInit(RBUF_Locked_t *locked, uint8_t *data, RBUF_size_t size, const RBUF_Lock_t *lock);
+
+/**
+ * \brief Get used size
+ * \param locked Ring to check
+ * \return Used size
+ */
+RBUF_size_t RBUF_LockedGetUsedSize(RBUF_Locked_t *locked);
+
+/**
+ * \brief Get free size
+ * \param locked Ring to check
+ * \return Free size
+ */
+RBUF_size_t RBUF_LockedGetFreeSize(RBUF_Locked_t *locked);
+
+/**
+ * \brief Write bytes, from the writer context
+ * \param locked Ring to write to
+ * \param data Data to write
+ * \param size Size to write
+ * \return true if written, false otherwise
+ */
+bool RBUF_LockedWriteString(RBUF_Locked_t *locked, const char *data, RBUF_size_t size);
+
+/**
+ * \brief Write uint8_t, from the writer context
+ * \param locked Ring to write to
+ * \param data Data to write
+ * \return true if written, false otherwise
+ */
+bool RBUF_LockedWriteUint8(RBUF_Locked_t *locked, uint8_t data);
+
+/**
+ * \brief Write uint16_t, MSB first, from the writer context
+ * \param locked Ring to write to
+ * \param data Data to write
+ * \return true if written, false otherwise
+ */
+bool RBUF_LockedWriteUint16(RBUF_Locked_t *locked, uint16_t data);
+
+/**
+ * \brief Write uint32_t, MSB first, from the writer context
+ * \param locked Ring to write to
+ * \param data Data to write
+ * \return true if written, false otherwise
+ */
+bool RBUF_LockedWriteUint32(RBUF_Locked_t *locked, uint32_t data);
+
+/**
+ * \brief Read uint8_t, from the reader context
+ * \param locked Ring to read from
+ * \return value read, 0 if empty
+ */
+uint8_t RBUF_LockedReadUint8(RBUF_Locked_t *locked);
+
+/**
+ * \brief Read requested size, from the reader context, if not possible does nothing
+ * \param buf_dst Destination buffer
+ * \param locked Ring to read from
+ * \param size Size to read
+ * \return true if requested size was read, false otherwise
+ */
+bool RBUF_LockedReadCopyBlock(BUF_t *buf_dst, RBUF_Locked_t *locked, RBUF_size_t size);
+
+/**
+ * \brief Read up to size bytes, from the reader context
+ * \param buf_dst Destination buffer
+ * \param locked Ring to read from
+ * \param size Size to read
+ * \return Size read
+ */
+RBUF_size_t RBUF_LockedReadCopyRaw(BUF_t *buf_dst, RBUF_Locked_t *locked, RBUF_size_t size);
+
+/**
+ * \brief Get free space in place, from the writer context, to fill before RBUF_LockedWriteCommit
+ * \param locked Ring to write to
+ * \param spans Free space from write index, second span used on rollover
+ * \return Free size
+ */
+RBUF_size_t RBUF_LockedWriteReserve(RBUF_Locked_t *locked, RBUF_Span_t spans[2]);
+
+/**
+ * \brief Publish bytes filled in place, from the writer context
+ * \param locked Ring written to
+ * \param size Size to publish
+ * \return true if published, false if size is greater than free size
+ */
+bool RBUF_LockedWriteCommit(RBUF_Locked_t *locked, RBUF_size_t size);
+
+/**
+ * \brief Get readable data in place, from the reader context, to consume before RBUF_LockedReadCommit
+ * \param locked Ring to read from
+ * \param spans Data from read index, second span used on rollover
+ * \return Used size
+ */
+RBUF_size_t RBUF_LockedReadPeek(RBUF_Locked_t *locked, RBUF_Span_t spans[2]);
+
+/**
+ * \brief Release bytes consumed in place, from the reader context
+ * \param locked Ring read from
+ * \param size Size to release
+ * \return true if released, false if size is greater than used size
+ */
+bool RBUF_LockedReadCommit(RBUF_Locked_t *locked, RBUF_size_t size);
@@ -0,0 +1,21 @@
+/**
+ * \file ring_buffer_lock_mutex.h
+ * \brief pthread mutex concurrency policy for RBUF_Locked_t
+ * \date 2026-10
+ * \author Nicolas Boutin
+ */
+
+#pragma once
+
+#include <pthread.h>
+
+#include "ring_buffer/ring_buffer_lock.h"
+
+// --- Public functions
+
+/**
+ * \brief Policy with a pthread mutex, for threads that may sleep while waiting
+ * \param lock Policy to initialize
+ * \param mutex Initialized mutex
+ */
+void RBUF_LockInitMutex(RBUF_Lock_t *lock, pthread_mutex_t *mutex);
@@ -0,0 +1,99 @@
+/**
+ * \file ring_buffer_monitor.h
+ * \brief Consistent Ring Buffer state snapshot for monitoring
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Reading read_index, write_index and sizes one call after another mixes
+ * states from different times. Once a monitor is attached, every write and
+ * read publishes its side (index, byte and operation counters) under its own
+ * sequence counter, odd while updating. A snapshot reads both sides between
+ * two loads of each counter and retries when one moved, so it never blocks
+ * the producer or the consumer, and each side only stores to its own block.
+ * One writer and one reader at a time, as for the ring itself.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public types
+
+typedef struct RBUF_MonitorSide_s
+{
+  uint32_t sequence; /*!< Odd while the side is updating */
+  uint32_t index;    /*!< Ring index after the last operation */
+  uint32_t bytes;    /*!< Bytes moved since attach, wraps */
+  uint32_t count;    /*!< Operations since attach, wraps */
+} RBUF_MonitorSide_t;
+
+typedef struct RBUF_Monitor_s
+{
+  RBUF_MonitorSide_t write; /*!< Updated by the writer only */
+  uint32_t peak;            /*!< Highest used size after a write, writer side */
+  RBUF_MonitorSide_t read;  /*!< Updated by the reader only */
+  uint32_t backlog;         /*!< Used size at attach */
+  uint32_t size;            /*!< Ring size */
+} RBUF_Monitor_t;
+
+typedef struct RBUF_Snapshot_s
+{
+  RBUF_size_t read_index;  /*!< Read index */
+  RBUF_size_t write_index; /*!< Write index */
+  RBUF_size_t used_size;   /*!< Used space, write_index - read_index */
+  RBUF_size_t free_size;   /*!< Free space, size - 1 - used_size */
+  RBUF_size_t peak;        /*!< Highest used size since attach */
+  uint32_t written;        /*!< Bytes written since attach */
+  uint32_t read;           /*!< Bytes read since attach */
+  uint32_t writes;         /*!< Write operations since attach */
+  uint32_t reads;          /*!< Read operations since attach */
+} RBUF_Snapshot_t;
+
+// --- Public functions
+
+/**
+ * \brief Start publishing buffer state
+ * \param buffer Buffer to monitor, quiescent during the call
+ * \param monitor Monitor storage, must outlive the monitoring
+ * \return true if attached, false on bad parameter
+ * \details Counters start from 0, data already in buffer counts in used size only
+ */
+bool RBUF_MonitorAttach(RBUF_t *buffer, RBUF_Monitor_t *monitor);
+
+/**
+ * \brief Stop publishing buffer state
+ * \param buffer Buffer to stop monitoring
+ */
+void RBUF_MonitorDetach(RBUF_t *buffer);
+
+/**
+ * \brief Take a consistent snapshot from any thread or interrupt
+ * \param monitor Monitor attached to a buffer
+ * \param snapshot Snapshot, left unchanged on failure
+ * \param retries Attempts after the first one when a side moved meanwhile
+ * \return true if snapshot was taken, false if every attempt raced an update or on bad parameter
+ * \details Snapshot holds the state after the last completed write and read.
+ * The bound keeps an interrupt from spinning on a side it preempted mid update.
+ */
+bool RBUF_MonitorSnapshot(const RBUF_Monitor_t *monitor, RBUF_Snapshot_t *snapshot, uint16_t retries);
+
+/**
+ * \brief Publish writer side, called by the ring write path
+ * \param buffer Buffer with a monitor
+ */
+void RBUF_MonitorOnWrite(RBUF_t *buffer);
+
+/**
+ * \brief Publish reader side, called by the ring read path
+ * \param buffer Buffer with a monitor
+ */
+void RBUF_MonitorOnRead(RBUF_t *buffer);
+
+/**
+ * \brief Publish indexes and size moved without data transfer, called by ring linearize and resize
+ * \param buffer Buffer with a monitor, no write nor read in progress
+ */
+void RBUF_MonitorOnMove(RBUF_t *buffer);
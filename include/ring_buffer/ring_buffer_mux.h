@@ -0,0 +1,114 @@
+/**
+ * \file ring_buffer_mux.h
+ * \brief Logical channels multiplexed over one Ring Buffer
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Low rate streams share one ring instead of one mostly idle ring each.
+ * Records are tagged with their channel and delivered in arrival order by a
+ * single dispatch loop to per channel handlers.
+ * A channel cannot hold more than its quota of ring bytes, so a noisy
+ * channel is refused before it fills the ring for the others.
+ *
+ * Record format:
+ * - channel id, 1 byte
+ * - payload size, 2 bytes big endian
+ * - payload
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_MUX_HEADER_SIZE 3U
+#define RBUF_MUX_PAYLOAD_MAX 0xFFFFU
+
+/**
+ * \brief Ring bytes taken by a record of payload_size bytes, to size quotas
+ */
+#define RBUF_MUX_RECORD_SIZE(payload_size) (RBUF_MUX_HEADER_SIZE + (payload_size))
+
+// --- Public types
+
+/**
+ * \brief Record handler, called from RBUF_MuxDispatch
+ * \param channel Record channel
+ * \param spans Payload in ring storage, second span used on rollover, valid during the call
+ * \param context Channel context
+ */
+typedef void (*RBUF_MuxHandler_t)(uint8_t channel, const RBUF_Span_t spans[2], void *context);
+
+typedef struct RBUF_MuxChannel_s
+{
+  RBUF_size_t quota;         /*!< Ring bytes the channel may hold, records included */
+  uint32_t written;          /*!< Ring bytes written, writer side */
+  uint32_t read;             /*!< Ring bytes dispatched, reader side */
+  uint32_t dropped;          /*!< Records dispatched without handler */
+  uint32_t refused;          /*!< Writes refused on quota */
+  RBUF_MuxHandler_t handler; /*!< Record handler, NULL to drop */
+  void *context;             /*!< Passed to handler */
+} RBUF_MuxChannel_t;
+
+typedef struct RBUF_Mux_s
+{
+  RBUF_t ring;                 /*!< Shared ring */
+  RBUF_MuxChannel_t *channels; /*!< Channels by id */
+  uint8_t channel_count;       /*!< Number of channels */
+} RBUF_Mux_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize multiplexer, channels start without handler and with the whole ring as quota
+ * \param mux Multiplexer to initialize
+ * \param data Ring data
+ * \param size Ring size
+ * \param channels Channel storage
+ * \param channel_count Number of channels
+ */
+void RBUF_MuxInit(RBUF_Mux_t *mux, uint8_t *data, RBUF_size_t size, RBUF_MuxChannel_t *channels,
+                  uint8_t channel_count);
+
+/**
+ * \brief Configure channel
+ * \param mux Multiplexer
+ * \param channel Channel id
+ * \param quota Ring bytes the channel may hold, use RBUF_MUX_RECORD_SIZE to account for headers
+ * \param handler Record handler, NULL to drop records
+ * \param context Passed to handler
+ * \return true if configured, false on bad parameter
+ */
+bool RBUF_MuxSetChannel(RBUF_Mux_t *mux, uint8_t channel, RBUF_size_t quota, RBUF_MuxHandler_t handler,
+                        void *context);
+
+/**
+ * \brief Write record to channel
+ * \param mux Multiplexer
+ * \param channel Channel id
+ * \param data Payload
+ * \param size Payload size, up to RBUF_MUX_PAYLOAD_MAX
+ * \return true if written, false if over channel quota, ring full or bad parameter
+ * \details The record is published at once, the reader never sees part of it
+ */
+bool RBUF_MuxWrite(RBUF_Mux_t *mux, uint8_t channel, const uint8_t *data, RBUF_size_t size);
+
+/**
+ * \brief Deliver records to their channel handler, in arrival order
+ * \param mux Multiplexer
+ * \param max_records Records to deliver at most, bounds the time spent
+ * \return Records delivered or dropped
+ */
+RBUF_size_t RBUF_MuxDispatch(RBUF_Mux_t *mux, RBUF_size_t max_records);
+
+/**
+ * \brief Get ring bytes held by a channel
+ * \param mux Multiplexer
+ * \param channel Channel id
+ * \return Used size, records included
+ */
+RBUF_size_t RBUF_MuxGetUsedSize(const RBUF_Mux_t *mux, uint8_t channel);
@@ -0,0 +1,287 @@
+/**
+ * \file ring_buffer_objects.hpp
+ * \brief Ring of heterogeneous C++ objects constructed in place
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Objects are built with placement new inside caller provided storage, each
+ * behind a header holding its destructor and type tag. An object that does
+ * not fit before the end of storage leaves a skip marker and starts over at
+ * the beginning. Consumers access the oldest object in place or move it out,
+ * its destructor runs on pop. No heap allocation, no serialization.
+ * Not thread safe, like RBUF_t.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace rbuf
+{
+
+class ObjectRing
+{
+public:
+  /**
+   * \brief Initialize empty ring over caller provided storage
+   * \param storage Storage, realigned to std::max_align_t if needed
+   * \param size Storage size
+   */
+  ObjectRing(void *storage, std::size_t size)
+  {
+    std::uintptr_t address = reinterpret_cast<std::uintptr_t>(storage);
+    std::size_t pad = (kBaseAlign - (address % kBaseAlign)) % kBaseAlign;
+
+    if ((storage != nullptr) && (size > pad))
+    {
+      data_ = static_cast<std::uint8_t *>(storage) + pad;
+      size_ = (size - pad) - ((size - pad) % kHeaderAlign);
+    }
+  }
+
+  ~ObjectRing()
+  {
+    Clear();
+  }
+
+  ObjectRing(const ObjectRing &) = delete;
+  ObjectRing &operator=(const ObjectRing &) = delete;
+
+  /**
+   * \brief Construct object in place at the ring tail
+   * \param args Constructor arguments
+   * \return Constructed object, nullptr if no room
+   */
+  template <typename T, typename... Args> T *Emplace(Args &&...args)
+  {
+    static_assert(alignof(T) <= kBaseAlign, "Over aligned types are not supported");
+    T *object = nullptr;
+    std::size_t position = 0U;
+    bool wrap = false;
+
+    if (Reserve(sizeof(T), alignof(T), position, wrap) == true)
+    {
+      std::size_t payload = AlignUp(position + sizeof(Header), alignof(T));
+
+      /* Ring state changes only once the constructor returned, a throwing constructor leaves it untouched */
+      object = ::new (static_cast<void *>(data_ + payload)) T(std::forward<Args>(args)...);
+      if (wrap == true)
+      {
+        if ((size_ - write_) >= sizeof(Header))
+        {
+          HeaderAt(write_)->type = nullptr;
+        }
+        used_ += size_ - write_;
+      }
+      Header *header = HeaderAt(position);
+      header->destroy = &Destroy<T>;
+      header->type = TypeTag<T>();
+      header->payload = static_cast<std::uint32_t>(payload - position);
+      header->size = static_cast<std::uint32_t>(AlignUp(payload + sizeof(T), kHeaderAlign) - position);
+      write_ = position + header->size;
+      used_ += header->size;
+    }
+    return object;
+  }
+
+  /**
+   * \brief Check if ring is empty
+   * \return true if empty, false otherwise
+   */
+  bool IsEmpty() const
+  {
+    return used_ == 0U;
+  }
+
+  /**
+   * \brief Check type of the oldest object
+   * \return true if oldest object is a T, false otherwise or if empty
+   */
+  template <typename T> bool Holds() const
+  {
+    return (IsEmpty() == false) && (HeaderAt(read_)->type == TypeTag<T>());
+  }
+
+  /**
+   * \brief Access oldest object in place
+   * \return Oldest object, nullptr if empty or not a T
+   */
+  template <typename T> T *Front()
+  {
+    T *object = nullptr;
+
+    if (Holds<T>() == true)
+    {
+      object = std::launder(reinterpret_cast<T *>(data_ + read_ + HeaderAt(read_)->payload));
+    }
+    return object;
+  }
+
+  /**
+   * \brief Move oldest object out, then destroy it
+   * \param out Destination
+   * \return true if moved, false if empty or not a T
+   */
+  template <typename T> bool PopInto(T &out)
+  {
+    bool popped = false;
+    T *object = Front<T>();
+
+    if (object != nullptr)
+    {
+      out = std::move(*object);
+      Pop();
+      popped = true;
+    }
+    return popped;
+  }
+
+  /**
+   * \brief Destroy oldest object
+   * \return true if an object was destroyed, false if empty
+   */
+  bool Pop()
+  {
+    bool popped = false;
+
+    if (IsEmpty() == false)
+    {
+      Header *header = HeaderAt(read_);
+
+      header->destroy(data_ + read_ + header->payload);
+      read_ += header->size;
+      used_ -= header->size;
+      SkipPadding();
+      popped = true;
+    }
+    return popped;
+  }
+
+  /**
+   * \brief Destroy every object
+   */
+  void Clear()
+  {
+    while (Pop() == true)
+    {
+    }
+  }
+
+  /**
+   * \brief Get storage in use, object headers and padding included
+   * \return Used size
+   */
+  std::size_t GetUsedSize() const
+  {
+    return used_;
+  }
+
+private:
+  struct Header
+  {
+    void (*destroy)(void *); /*!< Destructor thunk */
+    const void *type;        /*!< Type tag, nullptr for skip marker */
+    std::uint32_t payload;   /*!< Object offset from header */
+    std::uint32_t size;      /*!< Entry size, offset of next header */
+  };
+
+  static constexpr std::size_t kBaseAlign = alignof(std::max_align_t);
+  static constexpr std::size_t kHeaderAlign = alignof(Header);
+
+  template <typename T> static void Destroy(void *object)
+  {
+    static_cast<T *>(object)->~T();
+  }
+
+  template <typename T> static const void *TypeTag()
+  {
+    static const char tag = 0;
+    return &tag;
+  }
+
+  static std::size_t AlignUp(std::size_t value, std::size_t align)
+  {
+    return (value + align - 1U) & ~(align - 1U);
+  }
+
+  Header *HeaderAt(std::size_t position) const
+  {
+    return reinterpret_cast<Header *>(data_ + position);
+  }
+
+  static std::size_t EntrySize(std::size_t position, std::size_t size, std::size_t align)
+  {
+    return AlignUp(AlignUp(position + sizeof(Header), align) + size, kHeaderAlign) - position;
+  }
+
+  /**
+   * \brief Find room for an entry, wrapping to storage start if needed
+   * \param size Object size
+   * \param align Object alignment
+   * \param position Entry position
+   * \param wrap true if the entry starts over at storage start, skip marker to commit at write_
+   * \return true if room was found, false otherwise
+   */
+  bool Reserve(std::size_t size, std::size_t align, std::size_t &position, bool &wrap)
+  {
+    bool reserved = false;
+
+    if (IsEmpty() == true)
+    {
+      read_ = 0U;
+      write_ = 0U;
+    }
+    if ((write_ > read_) || (IsEmpty() == true)) // Free space is [write_, size_) then [0, read_)
+    {
+      if ((write_ + EntrySize(write_, size, align)) <= size_)
+      {
+        position = write_;
+        reserved = true;
+      }
+      else if (EntrySize(0U, size, align) <= read_)
+      {
+        position = 0U;
+        wrap = true;
+        reserved = true;
+      }
+    }
+    else if (write_ < read_) // Free space is [write_, read_)
+    {
+      if ((write_ + EntrySize(write_, size, align)) <= read_)
+      {
+        position = write_;
+        reserved = true;
+      }
+    }
+    return reserved;
+  }
+
+  /**
+   * \brief Move read position past a skip marker or a tail too short for a header
+   */
+  void SkipPadding()
+  {
+    if (IsEmpty() == true)
+    {
+      read_ = 0U;
+      write_ = 0U;
+    }
+    else if (((size_ - read_) < sizeof(Header)) || (HeaderAt(read_)->type == nullptr))
+    {
+      used_ -= size_ - read_;
+      read_ = 0U;
+    }
+  }
+
+  std::uint8_t *data_ = nullptr; /*!< Storage, aligned to std::max_align_t */
+  std::size_t size_ = 0U;        /*!< Storage size, multiple of header alignment */
+  std::size_t read_ = 0U;        /*!< Oldest entry position */
+  std::size_t write_ = 0U;       /*!< Next entry position */
+  std::size_t used_ = 0U;        /*!< Bytes in use, skipped tail included */
+};
+
+} // namespace rbuf
@@ -0,0 +1,114 @@
+/**
+ * \file ring_buffer_pool.h
+ * \brief Ring Buffer storage pool carved out of a single arena
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Blocks are rounded up to a size class. Classes are spaced by a quarter of
+ * a power of two (16, 32, 48, 64, 80, 96, 112, 128, 160, ... bytes), so past
+ * the smallest classes rounding wastes at most a fifth of a block. A free
+ * block goes to its class free list and is reused before the arena is
+ * bumped again, so create and destroy never walk the arena.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#ifndef RBUF_POOL_CLASS_COUNT
+#define RBUF_POOL_CLASS_COUNT 56U /*!< Size classes from 16 bytes to 512 KB, 64 bytes to 2 MB with padding */
+#endif
+
+#define RBUF_POOL_CLASS_MIN_SHIFT 4U  /*!< Smallest block is 16 bytes */
+#define RBUF_POOL_CACHE_LINE      64U /*!< Block alignment with cache line padding */
+#define RBUF_POOL_SUBCLASS_COUNT  4U  /*!< Size classes per power of two */
+
+// --- Public types
+
+typedef struct RBUF_Pool_s
+{
+  uint8_t *arena;                         /*!< Arena start, aligned */
+  size_t arena_size;                      /*!< Arena size after alignment */
+  size_t reserved_size;                   /*!< Bytes carved out of the arena (bump offset) */
+  size_t used_size;                       /*!< Bytes in live blocks */
+  size_t requested_size;                  /*!< Bytes requested for live blocks */
+  uint8_t min_shift;                      /*!< Smallest class shift */
+  void *free_list[RBUF_POOL_CLASS_COUNT]; /*!< Free blocks per size class */
+} RBUF_Pool_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize pool over caller provided arena
+ * \param pool Pool to initialize
+ * \param arena Arena start
+ * \param size Arena size
+ * \param cache_line_pad true to align and pad every block to RBUF_POOL_CACHE_LINE
+ */
+void RBUF_PoolInit(RBUF_Pool_t *pool, uint8_t *arena, size_t size, bool cache_line_pad);
+
+/**
+ * \brief Allocate a raw block
+ * \param pool Pool to allocate from
+ * \param size Requested size
+ * \return Block start, NULL if the arena is exhausted
+ */
+uint8_t *RBUF_PoolAlloc(RBUF_Pool_t *pool, size_t size);
+
+/**
+ * \brief Give back a raw block
+ * \param pool Pool the block was allocated from
+ * \param block Block start
+ * \param size Size requested at allocation
+ */
+void RBUF_PoolFree(RBUF_Pool_t *pool, uint8_t *block, size_t size);
+
+/**
+ * \brief Allocate storage and initialize empty buffer on it
+ * \param pool Pool to allocate from
+ * \param buffer Buffer to initialize
+ * \param size Buffer size
+ * \return true if buffer was created, false otherwise
+ */
+bool RBUF_PoolCreate(RBUF_Pool_t *pool, RBUF_t *buffer, RBUF_size_t size);
+
+/**
+ * \brief Give back buffer storage to the pool
+ * \param pool Pool the buffer was created from
+ * \param buffer Buffer to destroy, left empty with no storage
+ */
+void RBUF_PoolDestroy(RBUF_Pool_t *pool, RBUF_t *buffer);
+
+/**
+ * \brief Get bytes held by live blocks
+ * \param pool Pool to check
+ * \return Used size, including size class rounding
+ */
+size_t RBUF_PoolGetUsedSize(const RBUF_Pool_t *pool);
+
+/**
+ * \brief Get bytes lost to size class rounding
+ * \param pool Pool to check
+ * \return Used size minus the sizes requested for live blocks
+ */
+size_t RBUF_PoolGetWastedSize(const RBUF_Pool_t *pool);
+
+/**
+ * \brief Get bytes carved out of the arena so far
+ * \param pool Pool to check
+ * \return Reserved size, live blocks plus blocks waiting in free lists
+ */
+size_t RBUF_PoolGetReservedSize(const RBUF_Pool_t *pool);
+
+/**
+ * \brief Get bytes never carved out of the arena
+ * \param pool Pool to check
+ * \return Free size
+ */
+size_t RBUF_PoolGetFreeSize(const RBUF_Pool_t *pool);
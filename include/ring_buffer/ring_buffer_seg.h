@@ -0,0 +1,144 @@
+/**
+ * \file ring_buffer_seg.h
+ * \brief Growable Ring Buffer made of pool segments, for host side buffering
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Data lives in a chain of fixed size segments from an RBUF_Pool. A write
+ * reaching the end of the newest segment links a new one, a read leaving a
+ * segment returns it, so memory follows the backlog instead of its worst
+ * case. One drained segment is kept as spare so a backlog hovering around a
+ * segment boundary does not allocate and free on every crossing.
+ * Same write, read and in place read API as RBUF_t, contiguous data is split
+ * at segment boundaries instead of at rollover.
+ * Single context, for concurrent access wrap calls in a lock.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "buffer/buffer.h"
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_pool.h"
+
+// --- Public types
+
+typedef struct RBUF_Segment_s
+{
+  struct RBUF_Segment_s *next; /*!< Newer segment, NULL for the newest */
+} RBUF_Segment_t;              /*!< Header, segment data follows */
+
+typedef struct RBUF_Seg_s
+{
+  RBUF_Pool_t *pool;           /*!< Segment source */
+  RBUF_size_t segment_size;    /*!< Data bytes per segment */
+  uint16_t segment_max;        /*!< Segments in use at most, 0 for no limit but the pool */
+  uint16_t segment_count;      /*!< Segments in use */
+  RBUF_Segment_t *head;        /*!< Oldest segment, read side */
+  RBUF_Segment_t *tail;        /*!< Newest segment, write side */
+  RBUF_Segment_t *spare;       /*!< Drained segment kept for the next growth */
+  RBUF_size_t read_offset;     /*!< Read position in head */
+  RBUF_size_t write_offset;    /*!< Write position in tail */
+  size_t used_size;            /*!< Bytes held */
+} RBUF_Seg_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize empty segmented buffer, no segment is allocated yet
+ * \param seg Buffer to initialize
+ * \param pool Segment source
+ * \param segment_size Data bytes per segment
+ * \param segment_max Segments in use at most, 0 for no limit but the pool
+ */
+void RBUF_SegInit(RBUF_Seg_t *seg, RBUF_Pool_t *pool, RBUF_size_t segment_size, uint16_t segment_max);
+
+/**
+ * \brief Give every segment back to the pool, buffer is left empty
+ * \param seg Buffer to release
+ */
+void RBUF_SegDestroy(RBUF_Seg_t *seg);
+
+/**
+ * \brief Check for empty buffer
+ * \param seg Buffer to check
+ * \return true if buffer is empty, false otherwise
+ */
+bool RBUF_SegIsEmpty(const RBUF_Seg_t *seg);
+
+/**
+ * \brief Get used space in buffer
+ * \param seg Buffer to check
+ * \return Bytes held, may exceed RBUF_size_t range
+ */
+size_t RBUF_SegGetUsedSize(const RBUF_Seg_t *seg);
+
+/**
+ * \brief Get segments in use
+ * \param seg Buffer to check
+ * \return Segment count, spare excluded
+ */
+uint16_t RBUF_SegGetSegmentCount(const RBUF_Seg_t *seg);
+
+/**
+ * \brief Write uint8_t to buffer
+ * \param seg Buffer to write to
+ * \param data Data to write
+ * \return true if data was written, false if no segment could be added
+ */
+bool RBUF_SegWriteUint8(RBUF_Seg_t *seg, uint8_t data);
+
+/**
+ * \brief Write string to buffer
+ * \param seg Buffer to write to
+ * \param data String to write
+ * \param size Size of string to write
+ * \return true if data was written, false if the segments it needs could not be added
+ * \details Segments are taken before any byte is copied, nothing is written on failure
+ */
+bool RBUF_SegWriteString(RBUF_Seg_t *seg, const char *data, RBUF_size_t size);
+
+/**
+ * \brief Read uint8_t from buffer
+ * \param seg Buffer to read from
+ * \return value read, 0 if empty
+ */
+uint8_t RBUF_SegReadUint8(RBUF_Seg_t *seg);
+
+/**
+ * \brief Read requested size from buffer, if not possible does nothing
+ * \param buf_dst Destination buffer
+ * \param seg Source buffer
+ * \param size Size to read
+ * \return true if requested size was read, false otherwise
+ */
+bool RBUF_SegReadCopyBlock(BUF_t *buf_dst, RBUF_Seg_t *seg, RBUF_size_t size);
+
+/**
+ * \brief Read request size from buffer, if not possible return what can be read
+ * \param buf_dst Destination buffer
+ * \param seg Source buffer
+ * \param size Size to read
+ * \return Size read
+ */
+RBUF_size_t RBUF_SegReadCopyRaw(BUF_t *buf_dst, RBUF_Seg_t *seg, RBUF_size_t size);
+
+/**
+ * \brief Get the oldest data in place
+ * \param seg Buffer to check
+ * \param spans Data in the two oldest segments, second span used across a segment boundary
+ * \return Size in spans
+ * \details Spans stay valid until released with RBUF_SegReadCommit
+ */
+RBUF_size_t RBUF_SegPeek(const RBUF_Seg_t *seg, RBUF_Span_t spans[2]);
+
+/**
+ * \brief Release bytes consumed in place, drained segments go back to the pool
+ * \param seg Buffer to commit to
+ * \param size Size to release
+ * \return true if size was released, false if greater than used space
+ */
+bool RBUF_SegReadCommit(RBUF_Seg_t *seg, RBUF_size_t size);
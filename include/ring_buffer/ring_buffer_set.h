@@ -0,0 +1,83 @@
+/**
+ * \file ring_buffer_set.h
+ * \brief Set of Ring Buffers with readiness bitmap
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Member rings flag their bit on empty to non-empty transition and clear it
+ * when drained, so a dispatcher finds the next ring holding data with count
+ * trailing zeros over the bitmap instead of polling every ring.
+ * Ring id doubles as priority, lowest id first.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_SET_WORDS(count) (((count) + 31U) / 32U) /*!< Bitmap words for count rings */
+
+// --- Public types
+
+typedef struct RBUF_Set_s
+{
+  RBUF_t **rings;    /*!< Member rings by id, NULL for free slot */
+  uint32_t *ready;   /*!< Readiness bitmap, RBUF_SET_WORDS(capacity) words */
+  uint16_t capacity; /*!< Number of slots */
+  uint16_t cursor;   /*!< Round robin position */
+} RBUF_Set_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize empty set over caller provided storage
+ * \param set Set to initialize
+ * \param rings Member slots, capacity entries
+ * \param ready Readiness bitmap, RBUF_SET_WORDS(capacity) words
+ * \param capacity Number of slots
+ */
+void RBUF_SetInit(RBUF_Set_t *set, RBUF_t **rings, uint32_t *ready, uint16_t capacity);
+
+/**
+ * \brief Add ring to set
+ * \param set Set to add to
+ * \param buffer Ring to add, already initialized
+ * \param id Slot id, also the ring priority (0 highest)
+ * \return true if added, false if id is out of range or taken
+ */
+bool RBUF_SetAdd(RBUF_Set_t *set, RBUF_t *buffer, uint16_t id);
+
+/**
+ * \brief Remove ring from set
+ * \param set Set to remove from
+ * \param id Slot id
+ */
+void RBUF_SetRemove(RBUF_Set_t *set, uint16_t id);
+
+/**
+ * \brief Get member ring
+ * \param set Set to check
+ * \param id Slot id
+ * \return Ring, NULL if slot is free
+ */
+RBUF_t *RBUF_SetGetRing(const RBUF_Set_t *set, uint16_t id);
+
+/**
+ * \brief Find next ready ring, round robin after the last one returned
+ * \param set Set to check
+ * \param id Ready ring id
+ * \return true if a ring holds data, false otherwise
+ */
+bool RBUF_SetNextReady(RBUF_Set_t *set, uint16_t *id);
+
+/**
+ * \brief Find highest priority ready ring (lowest id)
+ * \param set Set to check
+ * \param id Ready ring id
+ * \return true if a ring holds data, false otherwise
+ */
+bool RBUF_SetFirstReady(const RBUF_Set_t *set, uint16_t *id);
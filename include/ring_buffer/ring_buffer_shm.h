@@ -0,0 +1,135 @@
+/**
+ * \file ring_buffer_shm.h
+ * \brief Ring Buffer shared between processes (shm_open/memfd_create) or persisted in a file
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Header and data live in a single mapped region and are linked by offsets,
+ * so the region is valid in every address space that maps it.
+ * One producer process and one consumer process access it lock-free.
+ * The same layout mapped from a regular file survives crashes and restarts.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "buffer/buffer.h"
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_SHM_MAGIC   0x46554252U /*!< "RBUF" */
+#define RBUF_SHM_VERSION 2U
+
+// --- Public types
+
+typedef struct RBUF_Shm_s
+{
+  void *base;                   /*!< Mapped region (header + data) */
+  size_t map_size;              /*!< Mapped region size */
+  uint32_t pending_write_index; /*!< Write index scheduled by the last RBUF_SYNC_ASYNC */
+  uint32_t pending_read_index;  /*!< Read index scheduled by the last RBUF_SYNC_ASYNC */
+  bool pending;                 /*!< Pending indices captured, committed by the next RBUF_SYNC_ASYNC */
+} RBUF_Shm_t;
+
+typedef enum RBUF_SyncMode_e
+{
+  RBUF_SYNC_NONE,  /*!< Commit indices only, durable against process crash */
+  RBUF_SYNC_ASYNC, /*!< Schedule write back (msync MS_ASYNC), commit indices of the previous call */
+  RBUF_SYNC_SYNC,  /*!< Wait for write back (msync MS_SYNC) then commit, durable against power loss */
+} RBUF_SyncMode_t;
+
+// --- Public functions
+
+/**
+ * \brief Size of the mapped region required for a ring of given size
+ * \param size Ring size
+ * \return Region size (header + data)
+ */
+size_t RBUF_ShmGetRegionSize(RBUF_size_t size);
+
+/**
+ * \brief Create an empty ring in a shared memory object
+ * \param shm Shared ring handle to initialize
+ * \param fd File descriptor from shm_open or memfd_create
+ * \param size Ring size
+ * \return true if the region was sized, mapped and initialized, false otherwise
+ * \details The region is truncated to RBUF_ShmGetRegionSize(size)
+ */
+bool RBUF_ShmCreate(RBUF_Shm_t *shm, int fd, RBUF_size_t size);
+
+/**
+ * \brief Attach to a ring previously created by RBUF_ShmCreate
+ * \param shm Shared ring handle to initialize
+ * \param fd File descriptor of the shared memory object
+ * \return true if the region was mapped and its magic/version are valid
+ */
+bool RBUF_ShmAttach(RBUF_Shm_t *shm, int fd);
+
+/**
+ * \brief Unmap the shared region, the file descriptor is left open
+ * \param shm Shared ring handle
+ */
+void RBUF_ShmDetach(RBUF_Shm_t *shm);
+
+/**
+ * \brief Open a file backed ring, creating it if needed
+ * \param shm Shared ring handle to initialize
+ * \param path File path
+ * \param size Ring size
+ * \return true if the ring was reopened or created, false otherwise
+ * \details
+ * A file holding a valid ring of the same size is reopened with the indices of the last RBUF_Sync,
+ * otherwise it is re-created empty. Reopening only validates the header, there is no replay.
+ * Release with RBUF_ShmDetach.
+ */
+bool RBUF_FileOpen(RBUF_Shm_t *shm, const char *path, RBUF_size_t size);
+
+/**
+ * \brief Commit current contents of a file backed ring
+ * \param shm Shared ring handle
+ * \param mode Durability of the commit
+ * \return true if committed (or write back scheduled for RBUF_SYNC_ASYNC), false otherwise
+ * \details With RBUF_SYNC_SYNC data is on storage before the committed indices are written. The producer
+ * never overwrites committed data, free space is measured from the committed read index, so drained
+ * bytes are reusable after the next commit only.
+ * RBUF_SYNC_ASYNC commits in two phases: each call commits the indices captured by the previous
+ * RBUF_SYNC_ASYNC call, whose write back was scheduled then, and captures the current ones. Call it
+ * periodically, commits lag one period. Any other mode drops the captured indices.
+ */
+bool RBUF_Sync(RBUF_Shm_t *shm, RBUF_SyncMode_t mode);
+
+/**
+ * \brief Get used space in shared ring
+ * \param shm Shared ring handle
+ * \return Used space
+ */
+RBUF_size_t RBUF_ShmGetUsedSize(const RBUF_Shm_t *shm);
+
+/**
+ * \brief Get free space in shared ring
+ * \param shm Shared ring handle
+ * \return Free space
+ */
+RBUF_size_t RBUF_ShmGetFreeSize(const RBUF_Shm_t *shm);
+
+/**
+ * \brief Write string to shared ring (producer side)
+ * \param shm Shared ring handle
+ * \param data String to write
+ * \param size Size of string to write
+ * \return true if data was written, false otherwise
+ */
+bool RBUF_ShmWriteString(RBUF_Shm_t *shm, const char *data, RBUF_size_t size);
+
+/**
+ * \brief Read request size from shared ring, if not possible return what can be read (consumer side)
+ * \param buf_dst Destination buffer
+ * \param shm Shared ring handle
+ * \param size Size to read
+ * \return Size read
+ */
+RBUF_size_t RBUF_ShmReadCopyRaw(BUF_t *buf_dst, RBUF_Shm_t *shm, RBUF_size_t size);
@@ -0,0 +1,95 @@
+/**
+ * \file ring_buffer_ts.h
+ * \brief Timestamped fixed size record Ring Buffer with time window queries
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Each record is a 32 bit timestamp followed by the payload. Timestamps are
+ * monotonic, so records are sorted in logical order and a time window is
+ * found by binary search. When full, pushing overwrites the oldest record.
+ * Timestamps are compared modulo 2^32, so a wrapping tick counter keeps
+ * working as long as stored records span less than 2^31 ticks.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_TS_TIMESTAMP_SIZE            4U
+#define RBUF_TS_RECORD_SIZE(payload_size) (RBUF_TS_TIMESTAMP_SIZE + (payload_size))
+
+// --- Public types
+
+typedef struct RBUF_Ts_s
+{
+  uint8_t *data;           /*!< Records storage */
+  RBUF_size_t record_size; /*!< Timestamp plus payload size */
+  RBUF_size_t capacity;    /*!< Number of records */
+  RBUF_size_t head;        /*!< Oldest record */
+  RBUF_size_t count;       /*!< Number of records */
+} RBUF_Ts_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize empty record buffer
+ * \param ts Record buffer to initialize
+ * \param data Records storage
+ * \param size Storage size, capacity is size / RBUF_TS_RECORD_SIZE(payload_size)
+ * \param payload_size Payload size of each record, capacity is 0 if a record does not fit in size
+ */
+void RBUF_TsInit(RBUF_Ts_t *ts, uint8_t *data, RBUF_size_t size, RBUF_size_t payload_size);
+
+/**
+ * \brief Get number of records
+ * \param ts Record buffer to check
+ * \return Number of records
+ */
+RBUF_size_t RBUF_TsGetCount(const RBUF_Ts_t *ts);
+
+/**
+ * \brief Push record, overwriting the oldest one when full
+ * \param ts Record buffer to push to
+ * \param timestamp Record timestamp, not before the newest one (modulo 2^32)
+ * \param payload Record payload, payload_size bytes
+ * \return true if record was pushed, false otherwise
+ */
+bool RBUF_TsPush(RBUF_Ts_t *ts, uint32_t timestamp, const uint8_t *payload);
+
+/**
+ * \brief Drop oldest record
+ * \param ts Record buffer to pop from
+ * \return true if a record was dropped, false if empty
+ */
+bool RBUF_TsPop(RBUF_Ts_t *ts);
+
+/**
+ * \brief Get record in logical order
+ * \param ts Record buffer to check
+ * \param index Logical index, 0 for oldest
+ * \return Record start (timestamp), NULL if out of range
+ */
+uint8_t *RBUF_TsGetRecord(const RBUF_Ts_t *ts, RBUF_size_t index);
+
+/**
+ * \brief Get timestamp of a record
+ * \param record Record start
+ * \return Record timestamp
+ */
+uint32_t RBUF_TsGetTimestamp(const uint8_t *record);
+
+/**
+ * \brief Find records with t0 <= timestamp <= t1, in O(log n)
+ * \param ts Record buffer to check
+ * \param t0 Window start
+ * \param t1 Window end
+ * \param spans Matching records in storage, oldest first, second span used on rollover
+ * \return Number of matching records
+ * \details Spans point into storage, they stay valid until matching records are overwritten
+ */
+RBUF_size_t RBUF_TsQuery(const RBUF_Ts_t *ts, uint32_t t0, uint32_t t1, RBUF_Span_t spans[2]);
@@ -0,0 +1,199 @@
+/**
+ * \file ring_buffer_unchecked.h
+ * \brief Inline Ring Buffer fast path without parameter checks
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * For hot loops on a ring known to be valid. Parameter checks of the regular
+ * API become assertions, compiled out with NDEBUG, so a byte push or pop
+ * inlines to a few instructions. Full and empty are still reported.
+ * Can be mixed with the regular API on the same ring, ring set readiness,
+ * watermarks, monitor and latency measurement are kept up to date.
+ */
+
+#pragma once
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#ifndef RBUF_ASSERT
+#define RBUF_ASSERT(condition) assert(condition) /*!< Override to route to a project assertion handler */
+#endif
+
+#define RBUF_ASSERT_VALID(buffer) RBUF_ASSERT(((buffer) != NULL) && ((buffer)->data != NULL) && ((buffer)->size > 0U))
+
+#define RBUF_UNCHECKED_HAS_HOOKS(buffer) ((buffer)->hooks != 0U)
+
+// --- Public functions
+
+/**
+ * \brief Check if buffer is empty
+ * \param buffer Valid buffer
+ * \return true if empty, false otherwise
+ */
+static inline bool RBUF_UncheckedIsEmpty(const RBUF_t *buffer)
+{
+  RBUF_ASSERT_VALID(buffer);
+  return buffer->write_index == buffer->read_index;
+}
+
+/**
+ * \brief Get used size
+ * \param buffer Valid buffer
+ * \return Used size
+ */
+static inline RBUF_size_t RBUF_UncheckedGetUsedSize(const RBUF_t *buffer)
+{
+  RBUF_ASSERT_VALID(buffer);
+  RBUF_size_t used_size = (RBUF_size_t) (buffer->write_index - buffer->read_index);
+
+  if (buffer->write_index < buffer->read_index) // Rollover
+  {
+    used_size = (RBUF_size_t) (used_size + buffer->size);
+  }
+  return used_size;
+}
+
+/**
+ * \brief Get free size
+ * \param buffer Valid buffer
+ * \return Free size
+ */
+static inline RBUF_size_t RBUF_UncheckedGetFreeSize(const RBUF_t *buffer)
+{
+  return (RBUF_size_t) (buffer->size - 1U - RBUF_UncheckedGetUsedSize(buffer));
+}
+
+/**
+ * \brief Write one byte
+ * \param buffer Valid buffer
+ * \param data Byte to write
+ * \return true if written, false if full
+ */
+static inline bool RBUF_UncheckedWriteUint8(RBUF_t *buffer, uint8_t data)
+{
+  RBUF_ASSERT_VALID(buffer);
+  bool written = false;
+  RBUF_size_t next = (RBUF_size_t) (buffer->write_index + 1U);
+
+  if (next == buffer->size)
+  {
+    next = 0U;
+  }
+  if (next != buffer->read_index)
+  {
+    buffer->data[buffer->write_index] = data;
+    buffer->write_index = next;
+    if (RBUF_UNCHECKED_HAS_HOOKS(buffer))
+    {
+      RBUF_NotifyWrite(buffer);
+    }
+    written = true;
+  }
+  return written;
+}
+
+/**
+ * \brief Read one byte
+ * \param buffer Valid buffer
+ * \param data Byte read
+ * \return true if read, false if empty
+ */
+static inline bool RBUF_UncheckedReadUint8(RBUF_t *buffer, uint8_t *data)
+{
+  RBUF_ASSERT_VALID(buffer);
+  RBUF_ASSERT(data != NULL);
+  bool read = false;
+
+  if (buffer->read_index != buffer->write_index)
+  {
+    RBUF_size_t next = (RBUF_size_t) (buffer->read_index + 1U);
+
+    *data = buffer->data[buffer->read_index];
+    buffer->read_index = (next == buffer->size) ? 0U : next;
+    if (RBUF_UNCHECKED_HAS_HOOKS(buffer))
+    {
+      RBUF_NotifyRead(buffer);
+    }
+    read = true;
+  }
+  return read;
+}
+
+/**
+ * \brief Write bytes, all or nothing
+ * \param buffer Valid buffer
+ * \param data Data to write, not overlapping buffer data
+ * \param size Size to write
+ * \return true if written, false if not enough free space
+ */
+static inline bool RBUF_UncheckedWriteString(RBUF_t *buffer, const char *data, RBUF_size_t size)
+{
+  RBUF_ASSERT(data != NULL);
+  bool written = false;
+
+  if (RBUF_UncheckedGetFreeSize(buffer) >= size)
+  {
+    RBUF_size_t size1 = (RBUF_size_t) (buffer->size - buffer->write_index);
+
+    if (size < size1)
+    {
+      memcpy(&buffer->data[buffer->write_index], data, size);
+      buffer->write_index = (RBUF_size_t) (buffer->write_index + size);
+    }
+    else // Rollover
+    {
+      memcpy(&buffer->data[buffer->write_index], data, size1);
+      memcpy(&buffer->data[0], &data[size1], (size_t) size - size1);
+      buffer->write_index = (RBUF_size_t) (size - size1);
+    }
+    if (RBUF_UNCHECKED_HAS_HOOKS(buffer))
+    {
+      RBUF_NotifyWrite(buffer);
+    }
+    written = true;
+  }
+  return written;
+}
+
+/**
+ * \brief Read bytes, all or nothing
+ * \param buffer Valid buffer
+ * \param data Destination, not overlapping buffer data
+ * \param size Size to read
+ * \return true if read, false if not enough used space
+ */
+static inline bool RBUF_UncheckedReadString(RBUF_t *buffer, char *data, RBUF_size_t size)
+{
+  RBUF_ASSERT(data != NULL);
+  bool read = false;
+
+  if (RBUF_UncheckedGetUsedSize(buffer) >= size)
+  {
+    RBUF_size_t size1 = (RBUF_size_t) (buffer->size - buffer->read_index);
+
+    if (size < size1)
+    {
+      memcpy(data, &buffer->data[buffer->read_index], size);
+      buffer->read_index = (RBUF_size_t) (buffer->read_index + size);
+    }
+    else // Rollover
+    {
+      memcpy(data, &buffer->data[buffer->read_index], size1);
+      memcpy(&data[size1], &buffer->data[0], (size_t) size - size1);
+      buffer->read_index = (RBUF_size_t) (size - size1);
+    }
+    if (RBUF_UNCHECKED_HAS_HOOKS(buffer))
+    {
+      RBUF_NotifyRead(buffer);
+    }
+    read = true;
+  }
+  return read;
+}
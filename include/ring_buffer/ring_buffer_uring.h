@@ -0,0 +1,135 @@
+/**
+ * \file ring_buffer_uring.h
+ * \brief Ring Buffer filling and draining with io_uring, Linux hosts
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * A stream binds a ring to a file descriptor in one direction. Reads are
+ * submitted straight into the ring free region and writes straight from its
+ * readable region, both spans at once on rollover, without staging copy.
+ * Completions commit the transferred size to the ring. Any number of streams
+ * share one submission queue, so one io_uring_enter call serves them all.
+ *
+ * Ring storage can be registered with the kernel (fixed buffers), which
+ * saves page pinning per operation. A fixed buffer operation covers one
+ * contiguous span, the part past rollover goes with the next operation.
+ *
+ * A stream has at most one operation in flight and owns its ring side:
+ * the ring write side for RBUF_URING_FILL, the read side for RBUF_URING_DRAIN.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <sys/uio.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_URING_OFFSET_NONE UINT64_MAX /*!< Use and advance the file position, required for sockets and pipes */
+#define RBUF_URING_BUFFER_NONE (-1)       /*!< Stream storage not registered */
+#define RBUF_URING_BUFFER_MAX  64U        /*!< Streams registered per instance */
+
+// --- Public types
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+typedef enum RBUF_UringDir_e
+{
+  RBUF_URING_FILL,  /*!< Read from fd into ring */
+  RBUF_URING_DRAIN, /*!< Write ring data to fd */
+} RBUF_UringDir_t;
+
+typedef struct RBUF_UringStream_s
+{
+  RBUF_t *ring;              /*!< Ring to fill or drain */
+  int fd;                    /*!< File descriptor */
+  RBUF_UringDir_t direction; /*!< Transfer direction */
+  uint64_t offset;           /*!< File offset, advanced on completion, or RBUF_URING_OFFSET_NONE */
+  int buffer_index;          /*!< Registered buffer index, or RBUF_URING_BUFFER_NONE */
+  struct iovec iov[2];       /*!< Spans of the operation in flight */
+  bool busy;                 /*!< Operation in flight */
+  bool eof;                  /*!< Fill reached end of file or peer closed */
+  int error;                 /*!< Last failed completion, negative errno, 0 if none */
+  uint64_t bytes;            /*!< Bytes transferred since init */
+} RBUF_UringStream_t;
+
+typedef struct RBUF_Uring_s
+{
+  int fd;                     /*!< io_uring instance, -1 if not initialized */
+  void *sq_map;               /*!< Submission ring mapping */
+  size_t sq_map_size;         /*!< Submission ring mapping size */
+  void *cq_map;               /*!< Completion ring mapping */
+  size_t cq_map_size;         /*!< Completion ring mapping size */
+  struct io_uring_sqe *sqes;  /*!< Submission entries */
+  size_t sqes_size;           /*!< Submission entries mapping size */
+  struct io_uring_cqe *cqes;  /*!< Completion entries */
+  uint32_t *sq_head;          /*!< Submission head, kernel owned */
+  uint32_t *sq_tail;          /*!< Submission tail */
+  uint32_t *sq_array;         /*!< Submission index array */
+  uint32_t sq_mask;           /*!< Submission ring mask */
+  uint32_t *cq_head;          /*!< Completion head */
+  uint32_t *cq_tail;          /*!< Completion tail, kernel owned */
+  uint32_t cq_mask;           /*!< Completion ring mask */
+  uint32_t queued;            /*!< Entries queued, not submitted yet */
+  uint32_t in_flight;         /*!< Operations submitted, not completed yet */
+  bool registered;            /*!< Fixed buffers registered */
+} RBUF_Uring_t;
+
+// --- Public functions
+
+/**
+ * \brief Create io_uring instance
+ * \param uring Instance to initialize
+ * \param entries Submission queue size, rounded up to a power of 2 by the kernel
+ * \return true if created, false if io_uring is not available (kernel, seccomp, rlimit)
+ */
+bool RBUF_UringInit(RBUF_Uring_t *uring, uint32_t entries);
+
+/**
+ * \brief Release io_uring instance, operations in flight are cancelled by the kernel
+ * \param uring Instance created by RBUF_UringInit
+ * \details Streams storage must outlive operations in flight, wait for them with RBUF_UringSubmit first
+ */
+void RBUF_UringDestroy(RBUF_Uring_t *uring);
+
+/**
+ * \brief Bind ring and file descriptor
+ * \param stream Stream to initialize
+ * \param ring Ring to fill or drain
+ * \param fd File descriptor
+ * \param direction Transfer direction
+ * \param offset Start file offset, or RBUF_URING_OFFSET_NONE
+ */
+void RBUF_UringStreamInit(RBUF_UringStream_t *stream, RBUF_t *ring, int fd, RBUF_UringDir_t direction,
+                          uint64_t offset);
+
+/**
+ * \brief Register streams ring storage as fixed buffers
+ * \param uring Instance, without registered buffers
+ * \param streams Streams, buffer_index is set to their position
+ * \param count Number of streams, up to RBUF_URING_BUFFER_MAX
+ * \return true if registered, false otherwise (streams keep regular transfers)
+ */
+bool RBUF_UringRegister(RBUF_Uring_t *uring, RBUF_UringStream_t *const *streams, uint16_t count);
+
+/**
+ * \brief Queue next transfer of a stream
+ * \param uring Instance
+ * \param stream Stream, idle
+ * \return true if queued, false if busy, nothing to transfer, end of file or submission queue full
+ */
+bool RBUF_UringQueue(RBUF_Uring_t *uring, RBUF_UringStream_t *stream);
+
+/**
+ * \brief Submit queued transfers and optionally wait for completions
+ * \param uring Instance
+ * \param wait_count Completions to wait for, 0 to return at once
+ * \return Completions processed, or negative errno if io_uring_enter failed
+ * \details Each completion commits its size to the stream ring and clears busy
+ */
+int RBUF_UringSubmit(RBUF_Uring_t *uring, uint32_t wait_count);
@@ -0,0 +1,83 @@
+/**
+ * \file ring_buffer_varint.h
+ * \brief LEB128 variable length integers in a Ring Buffer
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Unsigned values are stored 7 bits per byte, least significant group first,
+ * with bit 7 set on every byte but the last. Signed values are zigzag mapped
+ * first so small negative values stay short.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public constants
+
+#define RBUF_VARINT_SIZE_MAX 5U /*!< Encoded size of a 32 bit value */
+
+// --- Public types
+
+typedef enum RBUF_VarintStatus_e
+{
+  RBUF_VARINT_OK,         /*!< Value decoded */
+  RBUF_VARINT_INCOMPLETE, /*!< Value not fully written yet, nothing consumed */
+  RBUF_VARINT_INVALID,    /*!< Bad parameter, or more than RBUF_VARINT_SIZE_MAX bytes, consumed by reads */
+} RBUF_VarintStatus_t;
+
+// --- Public functions
+
+/**
+ * \brief Get encoded size of a value
+ * \param value Value to encode
+ * \return Encoded size, 1 to RBUF_VARINT_SIZE_MAX
+ */
+uint8_t RBUF_VarintGetSize(uint32_t value);
+
+/**
+ * \brief Write unsigned varint to buffer
+ * \param buffer Buffer to write to
+ * \param value Value to write
+ * \return true if value was written, false otherwise
+ */
+bool RBUF_WriteVarint(RBUF_t *buffer, uint32_t value);
+
+/**
+ * \brief Write zigzag signed varint to buffer
+ * \param buffer Buffer to write to
+ * \param value Value to write
+ * \return true if value was written, false otherwise
+ */
+bool RBUF_WriteVarintSigned(RBUF_t *buffer, int32_t value);
+
+/**
+ * \brief Decode unsigned varint at read index without consuming it
+ * \param buffer Buffer to read from
+ * \param value Decoded value
+ * \param size Encoded size, or malformed size on RBUF_VARINT_INVALID, may be NULL
+ * \return Decode status
+ */
+RBUF_VarintStatus_t RBUF_PeekVarint(const RBUF_t *buffer, uint32_t *value, uint8_t *size);
+
+/**
+ * \brief Read unsigned varint from buffer
+ * \param buffer Buffer to read from
+ * \param value Decoded value
+ * \return Decode status
+ * \details A malformed value is consumed, up to its RBUF_VARINT_SIZE_MAX bytes, so the stream resumes after it.
+ * Nothing is consumed on RBUF_VARINT_INCOMPLETE.
+ */
+RBUF_VarintStatus_t RBUF_ReadVarint(RBUF_t *buffer, uint32_t *value);
+
+/**
+ * \brief Read zigzag signed varint from buffer
+ * \param buffer Buffer to read from
+ * \param value Decoded value
+ * \return Decode status
+ * \details Consumes like RBUF_ReadVarint
+ */
+RBUF_VarintStatus_t RBUF_ReadVarintSigned(RBUF_t *buffer, int32_t *value);
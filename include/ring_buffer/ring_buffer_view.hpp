@@ -0,0 +1,311 @@
+/**
+ * \file ring_buffer_view.hpp
+ * \brief Read-only STL view over Ring Buffer contents
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * The view captures the readable region as two contiguous segments, the
+ * second one used on rollover. Its random access iterators work with any
+ * standard algorithm, paying a segment check per access. Segmented
+ * algorithms (ForEachSegment, Find, Accumulate, CopyTo) run the standard
+ * algorithm once per segment on raw pointers instead, which the compiler
+ * vectorises like a linear array.
+ * The view reflects the indices at construction, it does not consume data:
+ * release bytes with RBUF_ReadCommit. Iterators refer to the view, which
+ * must outlive them. Not thread safe, like RBUF_t.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <utility>
+
+extern "C" {
+#include "ring_buffer/ring_buffer.h"
+}
+
+namespace rbuf
+{
+
+class View
+{
+public:
+  /**
+   * \brief Contiguous part of the readable region
+   */
+  struct Segment
+  {
+    const std::uint8_t *data = nullptr; /*!< First byte */
+    std::size_t size = 0U;              /*!< Byte count */
+
+    const std::uint8_t *begin() const
+    {
+      return data;
+    }
+    const std::uint8_t *end() const
+    {
+      return data + size;
+    }
+  };
+
+  class Iterator
+  {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = std::uint8_t;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const std::uint8_t *;
+    using reference = const std::uint8_t &;
+
+    Iterator() = default;
+
+    Iterator(const View *view, std::size_t position) : view_(view), position_(position)
+    {
+    }
+
+    reference operator*() const
+    {
+      return view_->At(position_);
+    }
+    pointer operator->() const
+    {
+      return &view_->At(position_);
+    }
+    reference operator[](difference_type offset) const
+    {
+      return view_->At(static_cast<std::size_t>(static_cast<difference_type>(position_) + offset));
+    }
+
+    Iterator &operator++()
+    {
+      position_++;
+      return *this;
+    }
+    Iterator operator++(int)
+    {
+      Iterator previous = *this;
+      position_++;
+      return previous;
+    }
+    Iterator &operator--()
+    {
+      position_--;
+      return *this;
+    }
+    Iterator operator--(int)
+    {
+      Iterator previous = *this;
+      position_--;
+      return previous;
+    }
+    Iterator &operator+=(difference_type offset)
+    {
+      position_ = static_cast<std::size_t>(static_cast<difference_type>(position_) + offset);
+      return *this;
+    }
+    Iterator &operator-=(difference_type offset)
+    {
+      return *this += -offset;
+    }
+
+    friend Iterator operator+(Iterator it, difference_type offset)
+    {
+      return it += offset;
+    }
+    friend Iterator operator+(difference_type offset, Iterator it)
+    {
+      return it += offset;
+    }
+    friend Iterator operator-(Iterator it, difference_type offset)
+    {
+      return it -= offset;
+    }
+    friend difference_type operator-(const Iterator &a, const Iterator &b)
+    {
+      return static_cast<difference_type>(a.position_) - static_cast<difference_type>(b.position_);
+    }
+
+    friend bool operator==(const Iterator &a, const Iterator &b)
+    {
+      return a.position_ == b.position_;
+    }
+    friend bool operator!=(const Iterator &a, const Iterator &b)
+    {
+      return a.position_ != b.position_;
+    }
+    friend bool operator<(const Iterator &a, const Iterator &b)
+    {
+      return a.position_ < b.position_;
+    }
+    friend bool operator>(const Iterator &a, const Iterator &b)
+    {
+      return a.position_ > b.position_;
+    }
+    friend bool operator<=(const Iterator &a, const Iterator &b)
+    {
+      return a.position_ <= b.position_;
+    }
+    friend bool operator>=(const Iterator &a, const Iterator &b)
+    {
+      return a.position_ >= b.position_;
+    }
+
+    /**
+     * \brief Get position from the oldest byte
+     * \return Offset, the size to pass to RBUF_ReadCommit to consume up to this byte
+     */
+    std::size_t Position() const
+    {
+      return position_;
+    }
+
+  private:
+    const View *view_ = nullptr; /*!< Viewed region */
+    std::size_t position_ = 0U;  /*!< Offset from the oldest byte */
+  };
+
+  using value_type = std::uint8_t;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using const_reference = const std::uint8_t &;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+
+  /**
+   * \brief Capture readable region of a ring
+   * \param buffer Ring to view, empty view if not initialized
+   */
+  explicit View(const RBUF_t &buffer)
+  {
+    RBUF_Span_t spans[2] = {};
+
+    if (RBUF_ReadPeek(&buffer, spans) > 0U)
+    {
+      segments_[0] = {spans[0].data, spans[0].size};
+      segments_[1] = {spans[1].data, spans[1].size};
+    }
+  }
+
+  Iterator begin() const
+  {
+    return Iterator(this, 0U);
+  }
+  Iterator end() const
+  {
+    return Iterator(this, size());
+  }
+
+  std::size_t size() const
+  {
+    return segments_[0].size + segments_[1].size;
+  }
+  bool empty() const
+  {
+    return size() == 0U;
+  }
+
+  /**
+   * \brief Access byte, no bounds check
+   * \param position Offset from the oldest byte, lower than size()
+   * \return Byte
+   */
+  const std::uint8_t &operator[](std::size_t position) const
+  {
+    return At(position);
+  }
+
+  /**
+   * \brief Get contiguous segments, the second one is empty unless data wraps
+   * \return Segments in read order
+   */
+  const std::array<Segment, 2> &Segments() const
+  {
+    return segments_;
+  }
+
+  /**
+   * \brief Call function on each non-empty segment, in read order
+   * \param function Callable taking (const std::uint8_t *first, const std::uint8_t *last)
+   * \return function, like std::for_each
+   */
+  template <typename Function> Function ForEachSegment(Function function) const
+  {
+    for (const Segment &segment : segments_)
+    {
+      if (segment.size > 0U)
+      {
+        function(segment.begin(), segment.end());
+      }
+    }
+    return function;
+  }
+
+  /**
+   * \brief Find first byte equal to value, one std::find per segment
+   * \param value Byte to find
+   * \return Iterator to the byte, end() if not found
+   */
+  Iterator Find(std::uint8_t value) const
+  {
+    std::size_t position = size();
+    std::size_t offset = 0U;
+
+    for (std::size_t i = 0U; (i < segments_.size()) && (position == size()); i++)
+    {
+      const std::uint8_t *found = std::find(segments_[i].begin(), segments_[i].end(), value);
+
+      if (found != segments_[i].end())
+      {
+        position = offset + static_cast<std::size_t>(found - segments_[i].begin());
+      }
+      offset += segments_[i].size;
+    }
+    return Iterator(this, position);
+  }
+
+  /**
+   * \brief Fold bytes in read order, one std::accumulate per segment
+   * \param init Initial value
+   * \param operation Binary operation, std::plus by default
+   * \return Folded value
+   */
+  template <typename T, typename Operation = std::plus<>> T Accumulate(T init, Operation operation = {}) const
+  {
+    for (const Segment &segment : segments_)
+    {
+      init = std::accumulate(segment.begin(), segment.end(), std::move(init), operation);
+    }
+    return init;
+  }
+
+  /**
+   * \brief Copy bytes in read order, one std::copy per segment
+   * \param out Output iterator
+   * \return Output iterator past the last byte copied
+   */
+  template <typename OutputIt> OutputIt CopyTo(OutputIt out) const
+  {
+    for (const Segment &segment : segments_)
+    {
+      out = std::copy(segment.begin(), segment.end(), out);
+    }
+    return out;
+  }
+
+private:
+  const std::uint8_t &At(std::size_t position) const
+  {
+    return (position < segments_[0].size) ? segments_[0].data[position]
+                                          : segments_[1].data[position - segments_[0].size];
+  }
+
+  std::array<Segment, 2> segments_ = {}; /*!< Readable region in read order */
+};
+
+} // namespace rbuf
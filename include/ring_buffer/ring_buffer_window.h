@@ -0,0 +1,103 @@
+/**
+ * \file ring_buffer_window.h
+ * \brief Sliding window of samples with incremental sum, min, max and mean
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * The window keeps the last capacity samples. Sum is kept running, min and
+ * max are the front of monotonic deques of sample slots, so every aggregate
+ * is read in O(1) and each push costs O(1) amortized.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "ring_buffer/ring_buffer.h"
+
+// --- Public types
+
+typedef struct RBUF_WindowDeque_s
+{
+  RBUF_size_t *slots; /*!< Sample slots, capacity entries */
+  RBUF_size_t head;   /*!< Front entry */
+  RBUF_size_t count;  /*!< Number of entries */
+} RBUF_WindowDeque_t;
+
+typedef struct RBUF_Window_s
+{
+  int32_t *samples;       /*!< Sample storage, capacity entries */
+  RBUF_size_t capacity;   /*!< Window length */
+  RBUF_size_t head;       /*!< Oldest sample slot */
+  RBUF_size_t count;      /*!< Number of samples */
+  int64_t sum;            /*!< Running sum */
+  RBUF_WindowDeque_t min; /*!< Increasing samples, front is the minimum */
+  RBUF_WindowDeque_t max; /*!< Decreasing samples, front is the maximum */
+} RBUF_Window_t;
+
+// --- Public functions
+
+/**
+ * \brief Initialize empty window over caller provided storage
+ * \param window Window to initialize
+ * \param samples Sample storage, capacity entries
+ * \param min_slots Minimum deque storage, capacity entries
+ * \param max_slots Maximum deque storage, capacity entries
+ * \param capacity Window length
+ */
+void RBUF_WindowInit(RBUF_Window_t *window, int32_t *samples, RBUF_size_t *min_slots, RBUF_size_t *max_slots,
+                     RBUF_size_t capacity);
+
+/**
+ * \brief Push sample, evicting the oldest one when full
+ * \param window Window to push to
+ * \param sample Sample to push
+ * \return true if pushed, false otherwise
+ */
+bool RBUF_WindowPush(RBUF_Window_t *window, int32_t sample);
+
+/**
+ * \brief Evict oldest sample
+ * \param window Window to pop from
+ * \return true if a sample was evicted, false if empty
+ */
+bool RBUF_WindowPop(RBUF_Window_t *window);
+
+/**
+ * \brief Get number of samples
+ * \param window Window to check
+ * \return Number of samples
+ */
+RBUF_size_t RBUF_WindowGetCount(const RBUF_Window_t *window);
+
+/**
+ * \brief Get sum of samples
+ * \param window Window to check
+ * \return Sum, 0 if empty
+ */
+int64_t RBUF_WindowGetSum(const RBUF_Window_t *window);
+
+/**
+ * \brief Get minimum sample
+ * \param window Window to check
+ * \param min Minimum sample
+ * \return true if window holds samples, false otherwise
+ */
+bool RBUF_WindowGetMin(const RBUF_Window_t *window, int32_t *min);
+
+/**
+ * \brief Get maximum sample
+ * \param window Window to check
+ * \param max Maximum sample
+ * \return true if window holds samples, false otherwise
+ */
+bool RBUF_WindowGetMax(const RBUF_Window_t *window, int32_t *max);
+
+/**
+ * \brief Get mean of samples, truncated toward zero
+ * \param window Window to check
+ * \param mean Mean sample
+ * \return true if window holds samples, false otherwise
+ */
+bool RBUF_WindowGetMean(const RBUF_Window_t *window, int32_t *mean);
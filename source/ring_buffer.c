@@ -8,10 +8,28 @@
  * To differentiate them:
  * - full state: write  + 1 = read
  * - empty state: write == read
+ *
+ * A ring member of a ring set flags its readiness bit after every write and
+ * clears it when a read leaves it empty, then re-checks emptiness so a
+ * concurrent write is never left unflagged.
+ *
+ * Watermarks are checked on the same paths, a buffer without watermark pays
+ * a single pointer compare. Writes can only fire the high event and reads
+ * the low one. An attached monitor publishes the new index last, once the
+ * operation is complete.
  */
+#include <stdatomic.h>
 #include <string.h>
 
 #include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_monitor.h"
+#ifdef RBUF_CFG_LATENCY
+#include "ring_buffer/ring_buffer_latency.h"
+#endif
+
+// --- Private constants
+
+#define RBUF_ROTATE_CHUNK 64U /*!< Stack bytes used by linearize */
 
 // --- Private functions
 
@@ -19,10 +37,17 @@ static RBUF_size_t Rbuf_Min(RBUF_size_t a, RBUF_size_t b);
 static bool Rbuf_WillWriteRollover(const RBUF_t *buffer, RBUF_size_t size);
 static bool Rbuf_WillReadRollover(const RBUF_t *buffer, RBUF_size_t size);
 static bool Rbuf_is_memory_overlapping(const void *dest, const void *buf_src, size_t length);
+static void Rbuf_SignalWrite(RBUF_t *buffer);
+static void Rbuf_SignalRead(RBUF_t *buffer);
+static void Rbuf_CheckWatermark(RBUF_t *buffer, RBUF_WatermarkEvent_t event);
+static void Rbuf_SwapBlocks(uint8_t *a, uint8_t *b, RBUF_size_t size);
+static void Rbuf_Rotate(uint8_t *data, RBUF_size_t size_a, RBUF_size_t size_b);
+static void Rbuf_SignalMove(RBUF_t *buffer);
+static RBUF_size_t Rbuf_GetSpans(const RBUF_t *buffer, RBUF_size_t start, RBUF_size_t size, RBUF_Span_t spans[2]);
 
 // --- Public functions
 
-void RBUF_InitEmpty(RBUF_t *buffer, uint8_t *data, uint16_t size)
+void RBUF_InitEmpty(RBUF_t *buffer, uint8_t *data, RBUF_size_t size)
 {
   if (buffer != NULL)
   {
@@ -30,6 +55,14 @@ void RBUF_InitEmpty(RBUF_t *buffer, uint8_t *data, uint16_t size)
     buffer->size = size;
     buffer->read_index = 0;
     buffer->write_index = 0;
+    buffer->ready_word = NULL;
+    buffer->ready_mask = 0U;
+    buffer->watermark = NULL;
+    buffer->monitor = NULL;
+#ifdef RBUF_CFG_LATENCY
+    buffer->latency = NULL;
+#endif
+    buffer->hooks = 0U;
   }
 }
 
@@ -110,7 +143,7 @@ bool RBUF_WriteUint8(RBUF_t *buffer, uint8_t data)
 {
   bool written = false;
 
-  if ((RBUF_GetFreeSize(buffer) >= 1U) && (buffer != NULL) && (buffer->data != NULL))
+  if ((buffer != NULL) && (buffer->data != NULL) && (RBUF_GetFreeSize(buffer) >= 1U))
   {
     if (Rbuf_WillWriteRollover(buffer, 1U) == false)
     {
@@ -124,42 +157,26 @@ bool RBUF_WriteUint8(RBUF_t *buffer, uint8_t data)
       buffer->write_index = 0U;
     }
     written = true;
+    Rbuf_SignalWrite(buffer);
   }
   return written;
 }
 
 bool RBUF_WriteUint16(RBUF_t *buffer, uint16_t data)
 {
-  bool written = true;
+  /* Written as one block, hooks are signaled once */
+  const uint8_t bytes[2] = {(uint8_t)(data >> 8U), (uint8_t)(data & 0x00FFU)};
 
-  if (RBUF_GetFreeSize(buffer) >= 2U)
-  {
-    written &= RBUF_WriteUint8(buffer, (uint8_t)(data >> 8U));
-    written &= RBUF_WriteUint8(buffer, (uint8_t)(data & 0x00FFU));
-  }
-  else
-  {
-    written = false;
-  }
-  return written;
+  return RBUF_WriteString(buffer, (const char *) bytes, sizeof(bytes));
 }
 
 bool RBUF_WriteUint32(RBUF_t *buffer, uint32_t data)
 {
-  bool written = true;
+  /* Written as one block, hooks are signaled once */
+  const uint8_t bytes[4] = {(uint8_t)(data >> 24U), (uint8_t)(data >> 16U), (uint8_t)(data >> 8U),
+                            (uint8_t)(data & 0x000000FFU)};
 
-  if (RBUF_GetFreeSize(buffer) >= 4U)
-  {
-    written &= RBUF_WriteUint8(buffer, (uint8_t)(data >> 24U));
-    written &= RBUF_WriteUint8(buffer, (uint8_t)(data >> 16U));
-    written &= RBUF_WriteUint8(buffer, (uint8_t)(data >> 8U));
-    written &= RBUF_WriteUint8(buffer, (uint8_t)(data & 0x000000FFU));
-  }
-  else
-  {
-    written = false;
-  }
-  return written;
+  return RBUF_WriteString(buffer, (const char *) bytes, sizeof(bytes));
 }
 
 bool RBUF_WriteString(RBUF_t *buffer, const char *data, RBUF_size_t size)
@@ -184,6 +201,7 @@ bool RBUF_WriteString(RBUF_t *buffer, const char *data, RBUF_size_t size)
       buffer->write_index = size2;
     }
     written = true;
+    Rbuf_SignalWrite(buffer);
   }
   return written;
 }
@@ -221,6 +239,7 @@ bool RBUF_WriteCopy(RBUF_t *rbuf_dst, BUF_t *buf_src, RBUF_size_t size)
 
         written = true;
       }
+      Rbuf_SignalWrite(rbuf_dst);
     }
   }
   return written;
@@ -234,6 +253,7 @@ uint8_t RBUF_ReadUint8(RBUF_t *buffer)
   {
     data = buffer->data[buffer->read_index];
     buffer->read_index = (buffer->read_index + 1U) % buffer->size;
+    Rbuf_SignalRead(buffer);
   }
   return data;
 }
@@ -267,6 +287,7 @@ bool RBUF_ReadCopyBlock(BUF_t *buf_dst, RBUF_t *rbuf_src, RBUF_size_t size)
         buf_dst->write_index += size2;
       }
       read = true;
+      Rbuf_SignalRead(rbuf_src);
     }
   }
   return read;
@@ -301,10 +322,158 @@ RBUF_size_t RBUF_ReadCopyRaw(BUF_t *buf_dst, RBUF_t *rbuf_src, RBUF_size_t size)
       buf_dst->write_index += size2;
     }
     read = to_read;
+    Rbuf_SignalRead(rbuf_src);
   }
   return read;
 }
 
+RBUF_size_t RBUF_WriteReserve(const RBUF_t *buffer, RBUF_Span_t spans[2])
+{
+  RBUF_size_t free_size = 0U;
+
+  if ((buffer != NULL) && (buffer->data != NULL) && (spans != NULL))
+  {
+    free_size = Rbuf_GetSpans(buffer, buffer->write_index, RBUF_GetFreeSize(buffer), spans);
+  }
+  return free_size;
+}
+
+RBUF_size_t RBUF_ReadPeek(const RBUF_t *buffer, RBUF_Span_t spans[2])
+{
+  RBUF_size_t used_size = 0U;
+
+  if ((buffer != NULL) && (buffer->data != NULL) && (spans != NULL))
+  {
+    used_size = Rbuf_GetSpans(buffer, buffer->read_index, RBUF_GetUsedSize(buffer), spans);
+  }
+  return used_size;
+}
+
+bool RBUF_WriteCommit(RBUF_t *buffer, RBUF_size_t size)
+{
+  bool committed = false;
+
+  if ((buffer != NULL) && (buffer->size > 0U) && (RBUF_GetFreeSize(buffer) >= size))
+  {
+    buffer->write_index = (RBUF_size_t) (((uint32_t) buffer->write_index + size) % buffer->size);
+    committed = true;
+    Rbuf_SignalWrite(buffer);
+  }
+  return committed;
+}
+
+bool RBUF_ReadCommit(RBUF_t *buffer, RBUF_size_t size)
+{
+  bool committed = false;
+
+  if ((buffer != NULL) && (buffer->size > 0U) && (RBUF_GetUsedSize(buffer) >= size))
+  {
+    buffer->read_index = (RBUF_size_t) (((uint32_t) buffer->read_index + size) % buffer->size);
+    committed = true;
+    Rbuf_SignalRead(buffer);
+  }
+  return committed;
+}
+
+void RBUF_NotifyWrite(RBUF_t *buffer)
+{
+  if (buffer != NULL)
+  {
+    Rbuf_SignalWrite(buffer);
+  }
+}
+
+void RBUF_NotifyRead(RBUF_t *buffer)
+{
+  if (buffer != NULL)
+  {
+    Rbuf_SignalRead(buffer);
+  }
+}
+
+bool RBUF_Linearize(RBUF_t *buffer)
+{
+  bool linearized = false;
+
+  if ((buffer != NULL) && (buffer->data != NULL) && (buffer->size > 0U))
+  {
+    RBUF_size_t used_size = RBUF_GetUsedSize(buffer);
+
+    if (buffer->read_index <= buffer->write_index)
+    {
+      memmove(&buffer->data[0], &buffer->data[buffer->read_index], used_size);
+    }
+    else
+    {
+      Rbuf_Rotate(buffer->data, buffer->read_index, buffer->size - buffer->read_index);
+    }
+    buffer->read_index = 0U;
+    buffer->write_index = used_size;
+    Rbuf_SignalMove(buffer);
+    linearized = true;
+  }
+  return linearized;
+}
+
+bool RBUF_Resize(RBUF_t *buffer, uint8_t *data, RBUF_size_t size)
+{
+  bool resized = false;
+
+  if ((buffer != NULL) && (buffer->data != NULL) && (data != NULL) && (size > 0U)
+      && (RBUF_GetUsedSize(buffer) < size)
+      && ((buffer->watermark == NULL) || (buffer->watermark->high < size)))
+  {
+    RBUF_size_t used_size = RBUF_GetUsedSize(buffer);
+
+    if (Rbuf_WillReadRollover(buffer, used_size) == false)
+    {
+      memcpy(&data[0], &buffer->data[buffer->read_index], used_size);
+    }
+    else
+    {
+      RBUF_size_t size1 = buffer->size - buffer->read_index;
+
+      memcpy(&data[0], &buffer->data[buffer->read_index], size1);
+      memcpy(&data[size1], &buffer->data[0], used_size - size1);
+    }
+    buffer->data = data;
+    buffer->size = size;
+    buffer->read_index = 0U;
+    buffer->write_index = used_size;
+    Rbuf_SignalMove(buffer);
+    resized = true;
+  }
+  return resized;
+}
+
+bool RBUF_SetWatermark(RBUF_t *buffer, RBUF_Watermark_t *watermark, RBUF_size_t low, RBUF_size_t high,
+                       RBUF_WatermarkCb_t callback, void *context)
+{
+  bool set = false;
+
+  if ((buffer != NULL) && (watermark != NULL) && (callback != NULL) && (low < high) && (high < buffer->size))
+  {
+    watermark->high = high;
+    watermark->low = low;
+    watermark->is_high = (RBUF_GetUsedSize(buffer) >= high);
+    watermark->callback = callback;
+    watermark->context = context;
+    buffer->watermark = watermark;
+    buffer->hooks |= RBUF_HOOK_WATERMARK;
+    set = true;
+  }
+  return set;
+}
+
+void RBUF_ClearWatermark(RBUF_t *buffer)
+{
+  if (buffer != NULL)
+  {
+    buffer->watermark = NULL;
+    buffer->hooks &= (uint8_t) ~RBUF_HOOK_WATERMARK;
+  }
+}
+
 // --- Private functions
 
 static RBUF_size_t Rbuf_Min(RBUF_size_t a, RBUF_size_t b)
@@ -354,3 +523,207 @@ static bool Rbuf_is_memory_overlapping(const void *dest, const void *src, size_t
   }
   return is_overlapping;
 }
+
+/**
+ * \brief Flag buffer as ready in its ring set after a write
+ * \param buffer buffer written to
+ * \details The bit is only loaded when already set, the atomic update is paid on empty to non-empty transition
+ */
+static void Rbuf_SignalWrite(RBUF_t *buffer)
+{
+  uint8_t hooks = buffer->hooks;
+
+  if (hooks != 0U)
+  {
+    if ((hooks & RBUF_HOOK_READY) != 0U)
+    {
+      _Atomic uint32_t *word = (_Atomic uint32_t *) buffer->ready_word;
+
+      atomic_thread_fence(memory_order_seq_cst); /* Write index published before the bit is checked */
+      if ((atomic_load_explicit(word, memory_order_relaxed) & buffer->ready_mask) == 0U)
+      {
+        (void) atomic_fetch_or_explicit(word, buffer->ready_mask, memory_order_seq_cst);
+      }
+    }
+    if ((hooks & RBUF_HOOK_WATERMARK) != 0U)
+    {
+      Rbuf_CheckWatermark(buffer, RBUF_WATERMARK_HIGH);
+    }
+    if ((hooks & RBUF_HOOK_MONITOR) != 0U)
+    {
+      RBUF_MonitorOnWrite(buffer);
+    }
+#ifdef RBUF_CFG_LATENCY
+    if ((hooks & RBUF_HOOK_LATENCY) != 0U)
+    {
+      RBUF_LatencyOnWrite(buffer);
+    }
+#endif
+  }
+}
+
+/**
+ * \brief Clear buffer ready flag in its ring set when a read left it empty
+ * \param buffer buffer read from
+ */
+static void Rbuf_SignalRead(RBUF_t *buffer)
+{
+  uint8_t hooks = buffer->hooks;
+
+  if (hooks != 0U)
+  {
+    if (((hooks & RBUF_HOOK_READY) != 0U) && (buffer->write_index == buffer->read_index))
+    {
+      _Atomic uint32_t *word = (_Atomic uint32_t *) buffer->ready_word;
+
+      (void) atomic_fetch_and_explicit(word, ~buffer->ready_mask, memory_order_seq_cst);
+      if (buffer->write_index != buffer->read_index) /* Written meanwhile */
+      {
+        (void) atomic_fetch_or_explicit(word, buffer->ready_mask, memory_order_seq_cst);
+      }
+    }
+    if ((hooks & RBUF_HOOK_WATERMARK) != 0U)
+    {
+      Rbuf_CheckWatermark(buffer, RBUF_WATERMARK_LOW);
+    }
+    if ((hooks & RBUF_HOOK_MONITOR) != 0U)
+    {
+      RBUF_MonitorOnRead(buffer);
+    }
+#ifdef RBUF_CFG_LATENCY
+    if ((hooks & RBUF_HOOK_LATENCY) != 0U)
+    {
+      RBUF_LatencyOnRead(buffer);
+    }
+#endif
+  }
+}
+
+/**
+ * \brief Split a region of buffer data at rollover
+ * \param buffer buffer with data
+ * \param start Region start index
+ * \param size Region size, lower than buffer size
+ * \param spans Region parts, second one empty without rollover
+ * \return size
+ */
+static RBUF_size_t Rbuf_GetSpans(const RBUF_t *buffer, RBUF_size_t start, RBUF_size_t size, RBUF_Span_t spans[2])
+{
+  RBUF_size_t size1 = Rbuf_Min(size, (RBUF_size_t) (buffer->size - start));
+
+  spans[0].data = &buffer->data[start];
+  spans[0].size = size1;
+  spans[1].data = (size > size1) ? &buffer->data[0] : NULL;
+  spans[1].size = (RBUF_size_t) (size - size1);
+  return size;
+}
+
+/**
+ * \brief Exchange two non overlapping ranges
+ * \param a First range
+ * \param b Second range
+ * \param size Range size
+ */
+static void Rbuf_SwapBlocks(uint8_t *a, uint8_t *b, RBUF_size_t size)
+{
+  uint8_t chunk[RBUF_ROTATE_CHUNK];
+
+  while (size >= RBUF_ROTATE_CHUNK) /* Constant size copies inline to vector moves */
+  {
+    memcpy(chunk, a, RBUF_ROTATE_CHUNK);
+    memcpy(a, b, RBUF_ROTATE_CHUNK);
+    memcpy(b, chunk, RBUF_ROTATE_CHUNK);
+    a += RBUF_ROTATE_CHUNK;
+    b += RBUF_ROTATE_CHUNK;
+    size -= RBUF_ROTATE_CHUNK;
+  }
+  memcpy(chunk, a, size);
+  memcpy(a, b, size);
+  memcpy(b, chunk, size);
+}
+
+/**
+ * \brief Rotate data left, [A B] becomes [B A]
+ * \param data Data to rotate
+ * \param size_a Size of A, moved to the end
+ * \param size_b Size of B, moved to the start
+ * \details Block swaps place the shorter part at its final position until it fits in one
+ * chunk, then one memmove finishes. Every byte moves a bounded number of times, O(n).
+ */
+static void Rbuf_Rotate(uint8_t *data, RBUF_size_t size_a, RBUF_size_t size_b)
+{
+  uint8_t chunk[RBUF_ROTATE_CHUNK];
+
+  while ((size_a > RBUF_ROTATE_CHUNK) && (size_b > RBUF_ROTATE_CHUNK) && (size_a != size_b))
+  {
+    if (size_a < size_b) /* [A B1 B2] to [B2 B1 A], rotate [B2 B1] */
+    {
+      Rbuf_SwapBlocks(data, &data[size_b], size_a);
+      size_b -= size_a;
+    }
+    else /* [A1 A2 B] to [B A2 A1], rotate [A2 A1] */
+    {
+      Rbuf_SwapBlocks(data, &data[size_a], size_b);
+      data += size_b;
+      size_a -= size_b;
+    }
+  }
+  if (size_a == size_b)
+  {
+    Rbuf_SwapBlocks(data, &data[size_a], size_a);
+  }
+  else if (size_a <= RBUF_ROTATE_CHUNK)
+  {
+    memcpy(chunk, data, size_a);
+    memmove(data, &data[size_a], size_b);
+    memcpy(&data[size_b], chunk, size_a);
+  }
+  else
+  {
+    memcpy(chunk, &data[size_a], size_b);
+    memmove(&data[size_b], data, size_a);
+    memcpy(data, chunk, size_b);
+  }
+}
+
+/**
+ * \brief Let hooks follow indexes moved without data transfer
+ * \param buffer buffer linearized or resized
+ * \details Used size is unchanged, readiness and watermarks stay valid
+ */
+static void Rbuf_SignalMove(RBUF_t *buffer)
+{
+  if ((buffer->hooks & RBUF_HOOK_MONITOR) != 0U)
+  {
+    RBUF_MonitorOnMove(buffer);
+  }
+#ifdef RBUF_CFG_LATENCY
+  if ((buffer->hooks & RBUF_HOOK_LATENCY) != 0U)
+  {
+    RBUF_LatencyOnMove(buffer);
+  }
+#endif
+}
+
+/**
+ * \brief Fire watermark callback on crossing
+ * \param buffer buffer with a watermark
+ * \param event RBUF_WATERMARK_HIGH after a write, RBUF_WATERMARK_LOW after a read
+ * \details State flips before the callback, which may write to or read from the buffer
+ */
+static void Rbuf_CheckWatermark(RBUF_t *buffer, RBUF_WatermarkEvent_t event)
+{
+  RBUF_Watermark_t *watermark = buffer->watermark;
+  bool to_high = (event == RBUF_WATERMARK_HIGH);
+
+  if (watermark->is_high != to_high)
+  {
+    RBUF_size_t used_size = RBUF_GetUsedSize(buffer);
+
+    if ((to_high == true) ? (used_size >= watermark->high) : (used_size <= watermark->low))
+    {
+      watermark->is_high = to_high;
+      watermark->callback(buffer, event, watermark->context);
+    }
+  }
+}
@@ -0,0 +1,248 @@
+/**
+ * \file ring_buffer_bcast.c
+ * \brief Broadcast Ring Buffer, single writer and multiple independent readers
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * The shared ring read_index is set to the slowest reader before each write,
+ * so the regular write functions compute free space against it. Reads use a
+ * view of the ring with the reader own read index.
+ */
+#include "ring_buffer/ring_buffer_bcast.h"
+
+// --- Private functions
+
+static bool Rbuf_BcastIsReader(const RBUF_Bcast_t *bcast, uint8_t reader);
+static RBUF_size_t Rbuf_BcastGetReaderUsedSize(const RBUF_Bcast_t *bcast, uint8_t reader);
+static void Rbuf_BcastMakeRoom(RBUF_Bcast_t *bcast, RBUF_size_t size);
+static void Rbuf_BcastUpdateSlowest(RBUF_Bcast_t *bcast);
+static void Rbuf_BcastSignalDrained(RBUF_Bcast_t *bcast);
+
+// --- Public functions
+
+void RBUF_BcastInit(RBUF_Bcast_t *bcast, uint8_t *data, RBUF_size_t size, RBUF_BcastPolicy_t policy)
+{
+  if (bcast != NULL)
+  {
+    RBUF_InitEmpty(&bcast->ring, data, size);
+    for (uint8_t reader = 0U; reader < RBUF_BCAST_READER_MAX; reader++)
+    {
+      bcast->read_index[reader] = 0U;
+      bcast->lost_size[reader] = 0U;
+    }
+    bcast->reader_mask = 0U;
+    bcast->policy = policy;
+  }
+}
+
+bool RBUF_BcastAttach(RBUF_Bcast_t *bcast, uint8_t *reader)
+{
+  bool attached = false;
+
+  if ((bcast != NULL) && (reader != NULL))
+  {
+    for (uint8_t id = 0U; (id < RBUF_BCAST_READER_MAX) && (attached == false); id++)
+    {
+      if ((bcast->reader_mask & (1UL << id)) == 0U)
+      {
+        bcast->read_index[id] = bcast->ring.write_index;
+        bcast->lost_size[id] = 0U;
+        bcast->reader_mask |= (1UL << id);
+        *reader = id;
+        attached = true;
+      }
+    }
+  }
+  return attached;
+}
+
+void RBUF_BcastDetach(RBUF_Bcast_t *bcast, uint8_t reader)
+{
+  if (Rbuf_BcastIsReader(bcast, reader) == true)
+  {
+    bcast->reader_mask &= ~(1UL << reader);
+  }
+}
+
+bool RBUF_BcastIsAttached(const RBUF_Bcast_t *bcast, uint8_t reader)
+{
+  return Rbuf_BcastIsReader(bcast, reader);
+}
+
+RBUF_size_t RBUF_BcastGetFreeSize(const RBUF_Bcast_t *bcast)
+{
+  RBUF_size_t free_size = 0U;
+
+  if ((bcast != NULL) && (bcast->ring.size > 0U))
+  {
+    RBUF_size_t used_max = 0U;
+
+    for (uint8_t reader = 0U; reader < RBUF_BCAST_READER_MAX; reader++)
+    {
+      RBUF_size_t used = Rbuf_BcastGetReaderUsedSize(bcast, reader);
+      used_max = (used > used_max) ? used : used_max;
+    }
+    free_size = bcast->ring.size - 1U - used_max;
+  }
+  return free_size;
+}
+
+RBUF_size_t RBUF_BcastGetUsedSize(const RBUF_Bcast_t *bcast, uint8_t reader)
+{
+  RBUF_size_t used_size = 0U;
+
+  if (Rbuf_BcastIsReader(bcast, reader) == true)
+  {
+    used_size = Rbuf_BcastGetReaderUsedSize(bcast, reader);
+  }
+  return used_size;
+}
+
+uint32_t RBUF_BcastGetLostSize(const RBUF_Bcast_t *bcast, uint8_t reader)
+{
+  uint32_t lost_size = 0U;
+
+  if (Rbuf_BcastIsReader(bcast, reader) == true)
+  {
+    lost_size = bcast->lost_size[reader];
+  }
+  return lost_size;
+}
+
+bool RBUF_BcastWriteString(RBUF_Bcast_t *bcast, const char *data, RBUF_size_t size)
+{
+  bool written = false;
+
+  if ((bcast != NULL) && (bcast->ring.size > 0U) && (size < bcast->ring.size))
+  {
+    if ((bcast->policy != RBUF_BCAST_BLOCK) && (data != NULL))
+    {
+      Rbuf_BcastMakeRoom(bcast, size);
+    }
+    Rbuf_BcastUpdateSlowest(bcast);
+    written = RBUF_WriteString(&bcast->ring, data, size);
+  }
+  return written;
+}
+
+RBUF_size_t RBUF_BcastReadCopyRaw(BUF_t *buf_dst, RBUF_Bcast_t *bcast, uint8_t reader, RBUF_size_t size)
+{
+  RBUF_size_t read = 0U;
+
+  if (Rbuf_BcastIsReader(bcast, reader) == true)
+  {
+    RBUF_t view = bcast->ring;
+
+    view.read_index = bcast->read_index[reader];
+    view.ready_word = NULL; /* Other readers may still have data, see Rbuf_BcastSignalDrained */
+    view.watermark = NULL;  /* Watermarks follow the slowest reader, checked on write */
+    view.monitor = NULL;
+#ifdef RBUF_CFG_LATENCY
+    view.latency = NULL;
+#endif
+    view.hooks = 0U;
+    read = RBUF_ReadCopyRaw(buf_dst, &view, size);
+    bcast->read_index[reader] = view.read_index;
+    Rbuf_BcastSignalDrained(bcast);
+  }
+  return read;
+}
+
+// --- Private functions
+
+static bool Rbuf_BcastIsReader(const RBUF_Bcast_t *bcast, uint8_t reader)
+{
+  return (bcast != NULL) && (reader < RBUF_BCAST_READER_MAX) && ((bcast->reader_mask & (1UL << reader)) != 0U);
+}
+
+/**
+ * \brief Get data left to read by a reader, 0 if not attached
+ * \param bcast Broadcast buffer
+ * \param reader Reader id
+ * \return Used space seen by reader
+ */
+static RBUF_size_t Rbuf_BcastGetReaderUsedSize(const RBUF_Bcast_t *bcast, uint8_t reader)
+{
+  RBUF_size_t used_size = 0U;
+
+  if ((bcast->reader_mask & (1UL << reader)) != 0U)
+  {
+    RBUF_t view = bcast->ring;
+
+    view.read_index = bcast->read_index[reader];
+    used_size = RBUF_GetUsedSize(&view);
+  }
+  return used_size;
+}
+
+/**
+ * \brief Evict or lap every reader without room for size bytes
+ * \param bcast Broadcast buffer
+ * \param size Size about to be written, lower than ring size
+ */
+static void Rbuf_BcastMakeRoom(RBUF_Bcast_t *bcast, RBUF_size_t size)
+{
+  RBUF_size_t capacity = bcast->ring.size - 1U;
+
+  for (uint8_t reader = 0U; reader < RBUF_BCAST_READER_MAX; reader++)
+  {
+    RBUF_size_t used = Rbuf_BcastGetReaderUsedSize(bcast, reader);
+
+    if ((capacity - used) < size)
+    {
+      if (bcast->policy == RBUF_BCAST_EVICT)
+      {
+        bcast->reader_mask &= ~(1UL << reader);
+      }
+      else // RBUF_BCAST_LAP
+      {
+        RBUF_size_t skip = size - (capacity - used);
+
+        bcast->read_index[reader] = (RBUF_size_t) ((bcast->read_index[reader] + skip) % bcast->ring.size);
+        bcast->lost_size[reader] += skip;
+      }
+    }
+  }
+}
+
+/**
+ * \brief Set ring read index to the slowest reader, or to write index without reader
+ * \param bcast Broadcast buffer
+ */
+static void Rbuf_BcastUpdateSlowest(RBUF_Bcast_t *bcast)
+{
+  RBUF_size_t used_max = 0U;
+
+  bcast->ring.read_index = bcast->ring.write_index;
+  for (uint8_t reader = 0U; reader < RBUF_BCAST_READER_MAX; reader++)
+  {
+    RBUF_size_t used = Rbuf_BcastGetReaderUsedSize(bcast, reader);
+
+    if (used > used_max)
+    {
+      used_max = used;
+      bcast->ring.read_index = bcast->read_index[reader];
+    }
+  }
+}
+
+/**
+ * \brief Clear ring set readiness once every reader is drained
+ * \param bcast Broadcast buffer
+ */
+static void Rbuf_BcastSignalDrained(RBUF_Bcast_t *bcast)
+{
+  if ((bcast->ring.ready_word != NULL) && (RBUF_BcastGetFreeSize(bcast) == (bcast->ring.size - 1U)))
+  {
+    RBUF_t drained = bcast->ring;
+
+    drained.read_index = drained.write_index;
+    drained.watermark = NULL;
+    drained.monitor = NULL;
+#ifdef RBUF_CFG_LATENCY
+    drained.latency = NULL;
+#endif
+    drained.hooks &= RBUF_HOOK_READY;
+    RBUF_NotifyRead(&drained);
+  }
+}
@@ -0,0 +1,179 @@
+/**
+ * \file ring_buffer_bulk.c
+ * \brief Large block copies between Ring Buffer and linear buffers
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Bulk transfers copy both spans of the ring with RBUF_BulkCopy, then
+ * publish the ring index with the commit functions.
+ */
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#include <immintrin.h>
+#define RBUF_BULK_X86
+#endif
+
+#include "ring_buffer/ring_buffer_bulk.h"
+
+// --- Private constants
+
+#define RBUF_BULK_PREFETCH_DISTANCE 512U /*!< Bytes ahead of the load stream */
+
+// --- Private functions
+
+static bool Rbuf_BulkIsOverlapping(const uint8_t *a, size_t a_size, const uint8_t *b, size_t b_size);
+#ifdef RBUF_BULK_X86
+static void Rbuf_BulkCopyAvx(uint8_t *dst, const uint8_t *src, size_t size);
+static void Rbuf_BulkCopySse2(uint8_t *dst, const uint8_t *src, size_t size);
+#endif
+
+// --- Public functions
+
+void RBUF_BulkCopy(void *dst, const void *src, size_t size)
+{
+  if ((dst != NULL) && (src != NULL))
+  {
+#ifdef RBUF_BULK_X86
+    if (__builtin_cpu_supports("avx"))
+    {
+      Rbuf_BulkCopyAvx((uint8_t *) dst, (const uint8_t *) src, size);
+    }
+    else if (__builtin_cpu_supports("sse2"))
+    {
+      Rbuf_BulkCopySse2((uint8_t *) dst, (const uint8_t *) src, size);
+    }
+    else
+#endif
+    {
+      memcpy(dst, src, size);
+    }
+  }
+}
+
+bool RBUF_BulkWriteCopy(RBUF_t *rbuf_dst, BUF_t *buf_src, RBUF_size_t size)
+{
+  bool written = false;
+
+  if (size < RBUF_BULK_THRESHOLD)
+  {
+    written = RBUF_WriteCopy(rbuf_dst, buf_src, size);
+  }
+  else if ((rbuf_dst != NULL) && (buf_src != NULL) && (rbuf_dst->data != NULL) && (buf_src->data != NULL)
+           && (RBUF_GetFreeSize(rbuf_dst) >= BUF_GetToReadCount(buf_src)) && (BUF_GetToReadCount(buf_src) >= size)
+           && (Rbuf_BulkIsOverlapping(rbuf_dst->data, rbuf_dst->size, buf_src->data, buf_src->size) == false))
+  {
+    RBUF_size_t size1 = (RBUF_size_t) (rbuf_dst->size - rbuf_dst->write_index);
+
+    size1 = (size < size1) ? size : size1;
+    RBUF_BulkCopy(&rbuf_dst->data[rbuf_dst->write_index], &buf_src->data[buf_src->read_index], size1);
+    RBUF_BulkCopy(&rbuf_dst->data[0], &buf_src->data[buf_src->read_index + size1], (size_t) size - size1);
+    buf_src->read_index += size;
+    written = RBUF_WriteCommit(rbuf_dst, size);
+  }
+  return written;
+}
+
+bool RBUF_BulkReadCopyBlock(BUF_t *buf_dst, RBUF_t *rbuf_src, RBUF_size_t size)
+{
+  bool read = false;
+
+  if (size < RBUF_BULK_THRESHOLD)
+  {
+    read = RBUF_ReadCopyBlock(buf_dst, rbuf_src, size);
+  }
+  else if ((buf_dst != NULL) && (rbuf_src != NULL) && (buf_dst->data != NULL) && (rbuf_src->data != NULL)
+           && (BUF_GetFreeSize(buf_dst) >= RBUF_GetUsedSize(rbuf_src)) && (RBUF_GetUsedSize(rbuf_src) >= size)
+           && (Rbuf_BulkIsOverlapping(buf_dst->data, buf_dst->size, rbuf_src->data, rbuf_src->size) == false))
+  {
+    RBUF_size_t size1 = (RBUF_size_t) (rbuf_src->size - rbuf_src->read_index);
+
+    size1 = (size < size1) ? size : size1;
+    RBUF_BulkCopy(&buf_dst->data[buf_dst->write_index], &rbuf_src->data[rbuf_src->read_index], size1);
+    RBUF_BulkCopy(&buf_dst->data[buf_dst->write_index + size1], &rbuf_src->data[0], (size_t) size - size1);
+    buf_dst->write_index += size;
+    read = RBUF_ReadCommit(rbuf_src, size);
+  }
+  return read;
+}
+
+// --- Private functions
+
+static bool Rbuf_BulkIsOverlapping(const uint8_t *a, size_t a_size, const uint8_t *b, size_t b_size)
+{
+  uintptr_t a_start = (uintptr_t) a;
+  uintptr_t b_start = (uintptr_t) b;
+
+  return (a_start < (b_start + b_size)) && (b_start < (a_start + a_size));
+}
+
+#ifdef RBUF_BULK_X86
+/**
+ * \brief Non-temporal copy, 32 byte stores
+ * \param dst Destination
+ * \param src Source
+ * \param size Size to copy
+ * \details Head is copied up to destination alignment, tail below one line with memcpy
+ */
+__attribute__((target("avx"))) static void Rbuf_BulkCopyAvx(uint8_t *dst, const uint8_t *src, size_t size)
+{
+  size_t head = (32U - ((uintptr_t) dst % 32U)) % 32U;
+
+  head = (head < size) ? head : size;
+  memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  size -= head;
+  while (size >= 128U)
+  {
+    _mm_prefetch((const char *) (src + RBUF_BULK_PREFETCH_DISTANCE), _MM_HINT_NTA);
+    __m256i v0 = _mm256_loadu_si256((const __m256i *) (const void *) &src[0]);
+    __m256i v1 = _mm256_loadu_si256((const __m256i *) (const void *) &src[32]);
+    __m256i v2 = _mm256_loadu_si256((const __m256i *) (const void *) &src[64]);
+    __m256i v3 = _mm256_loadu_si256((const __m256i *) (const void *) &src[96]);
+    _mm256_stream_si256((__m256i *) (void *) &dst[0], v0);
+    _mm256_stream_si256((__m256i *) (void *) &dst[32], v1);
+    _mm256_stream_si256((__m256i *) (void *) &dst[64], v2);
+    _mm256_stream_si256((__m256i *) (void *) &dst[96], v3);
+    dst += 128U;
+    src += 128U;
+    size -= 128U;
+  }
+  _mm_sfence();
+  memcpy(dst, src, size);
+}
+
+/**
+ * \brief Non-temporal copy, 16 byte stores
+ * \param dst Destination
+ * \param src Source
+ * \param size Size to copy
+ */
+__attribute__((target("sse2"))) static void Rbuf_BulkCopySse2(uint8_t *dst, const uint8_t *src, size_t size)
+{
+  size_t head = (16U - ((uintptr_t) dst % 16U)) % 16U;
+
+  head = (head < size) ? head : size;
+  memcpy(dst, src, head);
+  dst += head;
+  src += head;
+  size -= head;
+  while (size >= 64U)
+  {
+    _mm_prefetch((const char *) (src + RBUF_BULK_PREFETCH_DISTANCE), _MM_HINT_NTA);
+    __m128i v0 = _mm_loadu_si128((const __m128i *) (const void *) &src[0]);
+    __m128i v1 = _mm_loadu_si128((const __m128i *) (const void *) &src[16]);
+    __m128i v2 = _mm_loadu_si128((const __m128i *) (const void *) &src[32]);
+    __m128i v3 = _mm_loadu_si128((const __m128i *) (const void *) &src[48]);
+    _mm_stream_si128((__m128i *) (void *) &dst[0], v0);
+    _mm_stream_si128((__m128i *) (void *) &dst[16], v1);
+    _mm_stream_si128((__m128i *) (void *) &dst[32], v2);
+    _mm_stream_si128((__m128i *) (void *) &dst[48], v3);
+    dst += 64U;
+    src += 64U;
+    size -= 64U;
+  }
+  _mm_sfence();
+  memcpy(dst, src, size);
+}
+#endif
@@ -0,0 +1,173 @@
+/**
+ * \file ring_buffer_coalesce.c
+ * \brief Coalescing writer batching small writes into one Ring Buffer publication
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Staged bytes sit between the ring write index and write index + staged,
+ * free space for staging is the ring free space minus staged.
+ * Publication is a single RBUF_WriteCommit.
+ */
+#include "ring_buffer/ring_buffer_coalesce.h"
+
+// --- Private functions
+
+static bool Rbuf_CoalesceIsValid(const RBUF_Coalesce_t *coalesce);
+static bool Rbuf_CoalesceStage(RBUF_Coalesce_t *coalesce, const uint8_t *data, RBUF_size_t size);
+static bool Rbuf_CoalesceIsDue(const RBUF_Coalesce_t *coalesce);
+
+// --- Public functions
+
+void RBUF_CoalesceInit(RBUF_Coalesce_t *coalesce, RBUF_t *ring, RBUF_size_t threshold, uint32_t delay,
+                       RBUF_ClockFn_t clock, void *context)
+{
+  if (coalesce != NULL)
+  {
+    coalesce->ring = ring;
+    coalesce->staged = 0U;
+    coalesce->threshold = (threshold > 0U) ? threshold : 1U;
+    coalesce->delay = delay;
+    coalesce->staged_time = 0U;
+    coalesce->clock = clock;
+    coalesce->context = context;
+    coalesce->writes = 0U;
+    coalesce->commits = 0U;
+  }
+}
+
+bool RBUF_CoalesceWriteUint8(RBUF_Coalesce_t *coalesce, uint8_t data)
+{
+  return Rbuf_CoalesceStage(coalesce, &data, 1U);
+}
+
+bool RBUF_CoalesceWriteUint16(RBUF_Coalesce_t *coalesce, uint16_t data)
+{
+  uint8_t bytes[2] = {(uint8_t) (data >> 8U), (uint8_t) (data & 0x00FFU)};
+
+  return Rbuf_CoalesceStage(coalesce, bytes, 2U);
+}
+
+bool RBUF_CoalesceWriteUint32(RBUF_Coalesce_t *coalesce, uint32_t data)
+{
+  uint8_t bytes[4] = {(uint8_t) (data >> 24U), (uint8_t) (data >> 16U), (uint8_t) (data >> 8U),
+                      (uint8_t) (data & 0x000000FFU)};
+
+  return Rbuf_CoalesceStage(coalesce, bytes, 4U);
+}
+
+bool RBUF_CoalesceWriteString(RBUF_Coalesce_t *coalesce, const char *data, RBUF_size_t size)
+{
+  bool written = false;
+
+  if (data != NULL)
+  {
+    written = Rbuf_CoalesceStage(coalesce, (const uint8_t *) data, size);
+  }
+  return written;
+}
+
+bool RBUF_CoalescePoll(RBUF_Coalesce_t *coalesce)
+{
+  bool flushed = false;
+
+  if ((Rbuf_CoalesceIsValid(coalesce) == true) && (Rbuf_CoalesceIsDue(coalesce) == true))
+  {
+    flushed = RBUF_CoalesceFlush(coalesce);
+  }
+  return flushed;
+}
+
+bool RBUF_CoalesceFlush(RBUF_Coalesce_t *coalesce)
+{
+  bool flushed = false;
+
+  if ((Rbuf_CoalesceIsValid(coalesce) == true) && (coalesce->staged > 0U))
+  {
+    flushed = RBUF_WriteCommit(coalesce->ring, coalesce->staged);
+    if (flushed == true)
+    {
+      coalesce->staged = 0U;
+      coalesce->commits++;
+    }
+  }
+  return flushed;
+}
+
+RBUF_size_t RBUF_CoalesceGetStagedSize(const RBUF_Coalesce_t *coalesce)
+{
+  RBUF_size_t staged = 0U;
+
+  if (coalesce != NULL)
+  {
+    staged = coalesce->staged;
+  }
+  return staged;
+}
+
+// --- Private functions
+
+static bool Rbuf_CoalesceIsValid(const RBUF_Coalesce_t *coalesce)
+{
+  return (coalesce != NULL) && (coalesce->ring != NULL) && (coalesce->ring->data != NULL)
+         && (coalesce->ring->size > 0U);
+}
+
+/**
+ * \brief Copy bytes past the staged ones, then publish if threshold or delay is reached
+ * \param coalesce Writer
+ * \param data Bytes to stage
+ * \param size Size to stage
+ * \return true if staged, false if the ring has no room
+ */
+static bool Rbuf_CoalesceStage(RBUF_Coalesce_t *coalesce, const uint8_t *data, RBUF_size_t size)
+{
+  bool staged = false;
+
+  if (Rbuf_CoalesceIsValid(coalesce) == true)
+  {
+    RBUF_t *ring = coalesce->ring;
+
+    if ((RBUF_GetFreeSize(ring) - coalesce->staged) >= size)
+    {
+      uint32_t index = ((uint32_t) ring->write_index + coalesce->staged) % ring->size;
+
+      for (RBUF_size_t i = 0U; i < size; i++)
+      {
+        ring->data[index] = data[i];
+        index = (index + 1U < ring->size) ? (index + 1U) : 0U;
+      }
+      if ((coalesce->staged == 0U) && (coalesce->clock != NULL))
+      {
+        coalesce->staged_time = coalesce->clock(coalesce->context);
+      }
+      coalesce->staged += size;
+      coalesce->writes++;
+      staged = true;
+      if ((coalesce->staged >= coalesce->threshold) || (Rbuf_CoalesceIsDue(coalesce) == true))
+      {
+        (void) RBUF_CoalesceFlush(coalesce);
+      }
+    }
+    else
+    {
+      (void) RBUF_CoalesceFlush(coalesce); /* Let the reader drain what is staged */
+    }
+  }
+  return staged;
+}
+
+/**
+ * \brief Check if the oldest staged byte waited the delay
+ * \param coalesce Valid writer
+ * \return true if staged bytes must be published, false otherwise
+ */
+static bool Rbuf_CoalesceIsDue(const RBUF_Coalesce_t *coalesce)
+{
+  bool due = false;
+
+  if ((coalesce->staged > 0U) && (coalesce->clock != NULL))
+  {
+    due = ((uint32_t) (coalesce->clock(coalesce->context) - coalesce->staged_time) >= coalesce->delay);
+  }
+  return due;
+}
@@ -0,0 +1,279 @@
+/**
+ * \file ring_buffer_compress.c
+ * \brief Compressing writer and decompressing reader over a Ring Buffer
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Blocks are encoded straight into ring storage from a local write index,
+ * header last, and committed to the ring once per block.
+ * Decoding reads ring storage across the wrap the same way and rebuilds
+ * raw bytes in the destination buffer, which also serves as delta history.
+ */
+#include "ring_buffer/ring_buffer_compress.h"
+
+// --- Private constants
+
+#define RBUF_COMPRESS_RUN_FLAG    0x80U
+#define RBUF_COMPRESS_RUN_MIN     3U
+#define RBUF_COMPRESS_RUN_MAX     (0x7FU + RBUF_COMPRESS_RUN_MIN)
+#define RBUF_COMPRESS_ZERO_FLAG   0x40U
+#define RBUF_COMPRESS_ZERO_MIN    2U
+#define RBUF_COMPRESS_ZERO_MAX    64U
+#define RBUF_COMPRESS_LITERAL_MAX 64U
+#define RBUF_COMPRESS_COUNT_MASK  0x3FU
+
+// --- Private types
+
+typedef struct Rbuf_Cursor_s
+{
+  RBUF_t *ring;      /*!< Ring to access */
+  RBUF_size_t index; /*!< Current index in ring data */
+} Rbuf_Cursor_t;
+
+// --- Private functions
+
+static void Rbuf_CursorPut(Rbuf_Cursor_t *cursor, uint8_t value);
+static uint8_t Rbuf_CursorGet(Rbuf_Cursor_t *cursor);
+static uint8_t Rbuf_CompressDelta(const RBUF_Compress_t *compress, uint16_t index);
+static void Rbuf_CompressPutLiterals(const RBUF_Compress_t *compress, Rbuf_Cursor_t *cursor, uint16_t start, uint16_t end);
+static bool Rbuf_CompressEmit(RBUF_Compress_t *compress);
+
+// --- Public functions
+
+void RBUF_CompressInit(RBUF_Compress_t *compress, RBUF_t *ring, uint8_t *block, uint16_t block_size, uint8_t stride)
+{
+  if (compress != NULL)
+  {
+    compress->ring = ring;
+    compress->block = block;
+    compress->block_size = (block_size <= RBUF_COMPRESS_BLOCK_MAX) ? block_size : 0U;
+    compress->block_used = 0U;
+    compress->stride = (stride > 0U) ? stride : 1U;
+    compress->raw_size = 0U;
+    compress->compressed_size = 0U;
+  }
+}
+
+RBUF_size_t RBUF_CompressWrite(RBUF_Compress_t *compress, const uint8_t *data, RBUF_size_t size)
+{
+  RBUF_size_t written = 0U;
+
+  if ((compress != NULL) && (compress->ring != NULL) && (compress->block != NULL) && (compress->block_size > 0U)
+      && (data != NULL))
+  {
+    bool full = false;
+
+    while ((written < size) && (full == false))
+    {
+      if (compress->block_used == compress->block_size)
+      {
+        full = (Rbuf_CompressEmit(compress) == false);
+      }
+      else
+      {
+        compress->block[compress->block_used] = data[written];
+        compress->block_used++;
+        written++;
+      }
+    }
+    if (compress->block_used == compress->block_size)
+    {
+      (void) Rbuf_CompressEmit(compress); /* Stays staged until next write or flush if ring is full */
+    }
+  }
+  return written;
+}
+
+bool RBUF_CompressFlush(RBUF_Compress_t *compress)
+{
+  bool flushed = false;
+
+  if ((compress != NULL) && (compress->ring != NULL))
+  {
+    flushed = (compress->block_used == 0U) || (Rbuf_CompressEmit(compress) == true);
+  }
+  return flushed;
+}
+
+bool RBUF_DecompressRead(BUF_t *buf_dst, RBUF_t *rbuf_src, uint8_t stride)
+{
+  bool read = false;
+
+  if ((buf_dst != NULL) && (buf_dst->data != NULL) && (rbuf_src != NULL) && (rbuf_src->data != NULL)
+      && (RBUF_GetUsedSize(rbuf_src) >= RBUF_COMPRESS_HEADER_SIZE))
+  {
+    Rbuf_Cursor_t cursor = {rbuf_src, rbuf_src->read_index};
+    uint16_t raw_size = (uint16_t) (Rbuf_CursorGet(&cursor) << 8U);
+    raw_size |= Rbuf_CursorGet(&cursor);
+    uint16_t encoded_size = (uint16_t) (Rbuf_CursorGet(&cursor) << 8U);
+    encoded_size |= Rbuf_CursorGet(&cursor);
+    uint32_t block_size = RBUF_COMPRESS_HEADER_SIZE + (uint32_t) encoded_size;
+
+    if ((raw_size > RBUF_COMPRESS_BLOCK_MAX) || (block_size > RBUF_COMPRESS_BOUND((uint32_t) raw_size))
+        || (block_size >= rbuf_src->size))
+    {
+      /* Corrupted header, the block can never complete and the next block start is lost */
+      (void) RBUF_ReadCommit(rbuf_src, RBUF_GetUsedSize(rbuf_src));
+    }
+    else if ((RBUF_GetUsedSize(rbuf_src) >= block_size) && (raw_size > buf_dst->size))
+    {
+      (void) RBUF_ReadCommit(rbuf_src, (RBUF_size_t) block_size); /* Never fits in buf_dst */
+    }
+    else if ((RBUF_GetUsedSize(rbuf_src) >= block_size) && (BUF_GetFreeSize(buf_dst) >= raw_size))
+    {
+      uint8_t *out = &buf_dst->data[buf_dst->write_index];
+      uint16_t out_count = 0U;
+      uint16_t in_count = 0U;
+      bool corrupted = false;
+
+      stride = (stride > 0U) ? stride : 1U;
+      while ((in_count < encoded_size) && (corrupted == false))
+      {
+        uint8_t control = Rbuf_CursorGet(&cursor);
+        bool run = ((control & RBUF_COMPRESS_RUN_FLAG) != 0U);
+        bool zero = (run == false) && ((control & RBUF_COMPRESS_ZERO_FLAG) != 0U);
+        uint16_t count = (uint16_t) ((control & RBUF_COMPRESS_COUNT_MASK) + 1U);
+        uint16_t token_size = 2U;
+        uint8_t delta = 0U;
+
+        if (run == true)
+        {
+          count = (uint16_t) ((control & 0x7FU) + RBUF_COMPRESS_RUN_MIN);
+        }
+        else if (zero == true)
+        {
+          count++; /* Zeros then one byte */
+        }
+        else
+        {
+          token_size = (uint16_t) (count + 1U);
+        }
+
+        corrupted = ((in_count + token_size) > encoded_size) || ((out_count + count) > raw_size);
+        for (uint16_t i = 0U; (i < count) && (corrupted == false); i++)
+        {
+          if (((run == false) && (zero == false)) || ((run == true) && (i == 0U)) || ((zero == true) && (i == (count - 1U))))
+          {
+            delta = Rbuf_CursorGet(&cursor);
+          }
+          out[out_count] = (uint8_t) (delta + ((out_count >= stride) ? out[out_count - stride] : 0U));
+          out_count++;
+        }
+        in_count += token_size;
+      }
+
+      if ((corrupted == false) && (out_count == raw_size))
+      {
+        buf_dst->write_index += raw_size;
+        read = true;
+      }
+      (void) RBUF_ReadCommit(rbuf_src, (RBUF_size_t) block_size);
+    }
+  }
+  return read;
+}
+
+// --- Private functions
+
+static void Rbuf_CursorPut(Rbuf_Cursor_t *cursor, uint8_t value)
+{
+  cursor->ring->data[cursor->index] = value;
+  cursor->index = (RBUF_size_t) ((cursor->index + 1U) % cursor->ring->size);
+}
+
+static uint8_t Rbuf_CursorGet(Rbuf_Cursor_t *cursor)
+{
+  uint8_t value = cursor->ring->data[cursor->index];
+  cursor->index = (RBUF_size_t) ((cursor->index + 1U) % cursor->ring->size);
+  return value;
+}
+
+static uint8_t Rbuf_CompressDelta(const RBUF_Compress_t *compress, uint16_t index)
+{
+  uint8_t reference = (index >= compress->stride) ? compress->block[index - compress->stride] : 0U;
+  return (uint8_t) (compress->block[index] - reference);
+}
+
+static void Rbuf_CompressPutLiterals(const RBUF_Compress_t *compress, Rbuf_Cursor_t *cursor, uint16_t start, uint16_t end)
+{
+  if (end > start)
+  {
+    Rbuf_CursorPut(cursor, (uint8_t) (end - start - 1U));
+    for (uint16_t i = start; i < end; i++)
+    {
+      Rbuf_CursorPut(cursor, Rbuf_CompressDelta(compress, i));
+    }
+  }
+}
+
+/**
+ * \brief Encode staged block into the ring
+ * \param compress Writer with block_used > 0
+ * \return true if block was written, false if the ring has no room for its worst case size
+ */
+static bool Rbuf_CompressEmit(RBUF_Compress_t *compress)
+{
+  bool emitted = false;
+  RBUF_t *ring = compress->ring;
+  uint16_t raw_size = compress->block_used;
+
+  if ((ring->data != NULL) && (RBUF_COMPRESS_BOUND((uint32_t) raw_size) <= RBUF_GetFreeSize(ring)))
+  {
+    Rbuf_Cursor_t cursor = {ring, (RBUF_size_t) ((ring->write_index + RBUF_COMPRESS_HEADER_SIZE) % ring->size)};
+    uint16_t literal_start = 0U;
+    uint16_t i = 0U;
+
+    while (i < raw_size)
+    {
+      uint8_t delta = Rbuf_CompressDelta(compress, i);
+      uint16_t run = 1U;
+
+      while (((i + run) < raw_size) && (run < RBUF_COMPRESS_RUN_MAX) && (Rbuf_CompressDelta(compress, i + run) == delta))
+      {
+        run++;
+      }
+      if ((delta == 0U) && (run >= RBUF_COMPRESS_ZERO_MIN) && (run <= RBUF_COMPRESS_ZERO_MAX) && ((i + run) < raw_size))
+      {
+        Rbuf_CompressPutLiterals(compress, &cursor, literal_start, i);
+        Rbuf_CursorPut(&cursor, (uint8_t) (RBUF_COMPRESS_ZERO_FLAG | (run - 1U)));
+        Rbuf_CursorPut(&cursor, Rbuf_CompressDelta(compress, i + run));
+        i += run + 1U;
+        literal_start = i;
+      }
+      else if (run >= RBUF_COMPRESS_RUN_MIN)
+      {
+        Rbuf_CompressPutLiterals(compress, &cursor, literal_start, i);
+        Rbuf_CursorPut(&cursor, (uint8_t) (RBUF_COMPRESS_RUN_FLAG | (run - RBUF_COMPRESS_RUN_MIN)));
+        Rbuf_CursorPut(&cursor, delta);
+        i += run;
+        literal_start = i;
+      }
+      else
+      {
+        i++;
+        if ((i - literal_start) == RBUF_COMPRESS_LITERAL_MAX)
+        {
+          Rbuf_CompressPutLiterals(compress, &cursor, literal_start, i);
+          literal_start = i;
+        }
+      }
+    }
+    Rbuf_CompressPutLiterals(compress, &cursor, literal_start, raw_size);
+
+    /* Header last, then publish the whole block at once */
+    uint16_t encoded_size = (uint16_t) ((cursor.index + ring->size - ring->write_index) % ring->size)
+                            - RBUF_COMPRESS_HEADER_SIZE;
+    Rbuf_Cursor_t header = {ring, ring->write_index};
+    Rbuf_CursorPut(&header, (uint8_t) (raw_size >> 8U));
+    Rbuf_CursorPut(&header, (uint8_t) (raw_size & 0x00FFU));
+    Rbuf_CursorPut(&header, (uint8_t) (encoded_size >> 8U));
+    Rbuf_CursorPut(&header, (uint8_t) (encoded_size & 0x00FFU));
+    (void) RBUF_WriteCommit(ring, RBUF_COMPRESS_HEADER_SIZE + encoded_size);
+
+    compress->raw_size += raw_size;
+    compress->compressed_size += RBUF_COMPRESS_HEADER_SIZE + (uint32_t) encoded_size;
+    compress->block_used = 0U;
+    emitted = true;
+  }
+  return emitted;
+}
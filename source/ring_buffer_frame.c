@@ -0,0 +1,348 @@
+/**
+ * \file ring_buffer_frame.c
+ * \brief COBS and SLIP framing over Ring Buffer storage
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Ring regions are handled as two spans from RBUF_ReadPeek and
+ * RBUF_WriteReserve, addressed by offset from their start. The delimiter is
+ * searched with memchr, so an incomplete frame polled again costs a scan
+ * and no decode.
+ */
+#include <string.h>
+
+#include "ring_buffer/ring_buffer_frame.h"
+
+// --- Private types
+
+typedef RBUF_FrameStatus_t (*Rbuf_FrameDecodeFn_t)(BUF_t *buf_dst, const RBUF_Span_t spans[2], uint32_t frame_size);
+
+// --- Private functions
+
+static RBUF_FrameStatus_t Rbuf_FrameDecode(BUF_t *buf_dst, RBUF_t *rbuf_src, uint8_t delimiter,
+                                           Rbuf_FrameDecodeFn_t decode);
+static RBUF_FrameStatus_t Rbuf_CobsDecodeFrame(BUF_t *buf_dst, const RBUF_Span_t spans[2], uint32_t frame_size);
+static RBUF_FrameStatus_t Rbuf_SlipDecodeFrame(BUF_t *buf_dst, const RBUF_Span_t spans[2], uint32_t frame_size);
+static uint32_t Rbuf_FrameFind(const RBUF_Span_t spans[2], uint32_t start, uint32_t end, uint8_t value);
+static uint8_t Rbuf_FrameGet(const RBUF_Span_t spans[2], uint32_t offset);
+static void Rbuf_FrameCopyOut(const RBUF_Span_t spans[2], uint32_t offset, uint8_t *data, uint32_t size);
+static void Rbuf_FrameCopyIn(const RBUF_Span_t spans[2], uint32_t offset, const uint8_t *data, uint32_t size);
+
+// --- Public functions
+
+RBUF_FrameStatus_t RBUF_CobsDecode(BUF_t *buf_dst, RBUF_t *rbuf_src)
+{
+  return Rbuf_FrameDecode(buf_dst, rbuf_src, RBUF_COBS_DELIMITER, Rbuf_CobsDecodeFrame);
+}
+
+bool RBUF_CobsEncode(RBUF_t *rbuf_dst, const uint8_t *data, RBUF_size_t size)
+{
+  bool written = false;
+  RBUF_Span_t spans[2];
+
+  if (((data != NULL) || (size == 0U))
+      && (RBUF_WriteReserve(rbuf_dst, spans) >= RBUF_COBS_BOUND((uint32_t) size)))
+  {
+    uint32_t offset = 0U;
+    uint32_t remaining = size;
+    bool more = true;
+
+    while (more == true)
+    {
+      uint32_t chunk = (remaining < 254U) ? remaining : 254U;
+      const uint8_t *zero = (chunk > 0U) ? memchr(data, 0, chunk) : NULL;
+      uint32_t run = (zero != NULL) ? (uint32_t) (zero - data) : chunk;
+      uint8_t code = (uint8_t) (run + 1U);
+
+      Rbuf_FrameCopyIn(spans, offset, &code, 1U);
+      Rbuf_FrameCopyIn(spans, offset + 1U, data, run);
+      offset += run + 1U;
+      data += run;
+      remaining -= run;
+      if (zero != NULL) /* Zero implied by the code, a block follows even if empty */
+      {
+        data++;
+        remaining--;
+      }
+      else
+      {
+        more = (remaining > 0U);
+      }
+    }
+    Rbuf_FrameCopyIn(spans, offset, &(uint8_t) {RBUF_COBS_DELIMITER}, 1U);
+    written = RBUF_WriteCommit(rbuf_dst, (RBUF_size_t) (offset + 1U));
+  }
+  return written;
+}
+
+RBUF_FrameStatus_t RBUF_SlipDecode(BUF_t *buf_dst, RBUF_t *rbuf_src)
+{
+  return Rbuf_FrameDecode(buf_dst, rbuf_src, RBUF_SLIP_END, Rbuf_SlipDecodeFrame);
+}
+
+bool RBUF_SlipEncode(RBUF_t *rbuf_dst, const uint8_t *data, RBUF_size_t size)
+{
+  bool written = false;
+  RBUF_Span_t spans[2];
+
+  if (((data != NULL) || (size == 0U))
+      && (RBUF_WriteReserve(rbuf_dst, spans) >= RBUF_SLIP_BOUND((uint32_t) size)))
+  {
+    uint32_t offset = 0U;
+    uint32_t start = 0U;
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+      if ((data[i] == RBUF_SLIP_END) || (data[i] == RBUF_SLIP_ESC))
+      {
+        uint8_t escape[2] = {RBUF_SLIP_ESC, (data[i] == RBUF_SLIP_END) ? RBUF_SLIP_ESC_END : RBUF_SLIP_ESC_ESC};
+
+        Rbuf_FrameCopyIn(spans, offset, &data[start], i - start);
+        offset += i - start;
+        Rbuf_FrameCopyIn(spans, offset, escape, 2U);
+        offset += 2U;
+        start = i + 1U;
+      }
+    }
+    Rbuf_FrameCopyIn(spans, offset, &data[start], size - start);
+    offset += size - start;
+    Rbuf_FrameCopyIn(spans, offset, &(uint8_t) {RBUF_SLIP_END}, 1U);
+    written = RBUF_WriteCommit(rbuf_dst, (RBUF_size_t) (offset + 1U));
+  }
+  return written;
+}
+
+// --- Private functions
+
+/**
+ * \brief Skip empty frames, then decode the next complete one
+ * \param buf_dst Destination buffer
+ * \param rbuf_src Ring holding encoded frames
+ * \param delimiter Frame delimiter
+ * \param decode Decoder of one frame, delimiter excluded
+ * \return Decode status
+ */
+static RBUF_FrameStatus_t Rbuf_FrameDecode(BUF_t *buf_dst, RBUF_t *rbuf_src, uint8_t delimiter,
+                                           Rbuf_FrameDecodeFn_t decode)
+{
+  RBUF_FrameStatus_t status = RBUF_FRAME_INCOMPLETE;
+  RBUF_Span_t spans[2];
+
+  if ((buf_dst != NULL) && (buf_dst->data != NULL))
+  {
+    bool full = RBUF_IsFull(rbuf_src);
+    uint32_t used_size = RBUF_ReadPeek(rbuf_src, spans);
+    uint32_t start = 0U;
+    uint32_t end = Rbuf_FrameFind(spans, start, used_size, delimiter);
+
+    while ((end == start) && (end < used_size)) /* Empty frame */
+    {
+      start++;
+      end = Rbuf_FrameFind(spans, start, used_size, delimiter);
+    }
+    if (end < used_size)
+    {
+      RBUF_Span_t frame[2];
+
+      (void) RBUF_ReadCommit(rbuf_src, (RBUF_size_t) start);
+      (void) RBUF_ReadPeek(rbuf_src, frame);
+      status = decode(buf_dst, frame, end - start);
+      (void) RBUF_ReadCommit(rbuf_src, (RBUF_size_t) (end - start + 1U));
+    }
+    else if ((start == 0U) && (full == true)) /* Frame can never complete, drop it to unblock the stream */
+    {
+      (void) RBUF_ReadCommit(rbuf_src, (RBUF_size_t) used_size);
+      status = RBUF_FRAME_OVERSIZE;
+    }
+    else
+    {
+      (void) RBUF_ReadCommit(rbuf_src, (RBUF_size_t) start);
+    }
+  }
+  return status;
+}
+
+/**
+ * \brief Decode one COBS frame
+ * \param buf_dst Destination buffer
+ * \param spans Ring data from frame start
+ * \param frame_size Encoded size, delimiter excluded
+ * \return Decode status
+ */
+static RBUF_FrameStatus_t Rbuf_CobsDecodeFrame(BUF_t *buf_dst, const RBUF_Span_t spans[2], uint32_t frame_size)
+{
+  RBUF_FrameStatus_t status = RBUF_FRAME_DECODED;
+  uint8_t *out = &buf_dst->data[buf_dst->write_index];
+  uint32_t out_free = BUF_GetFreeSize(buf_dst);
+  uint32_t out_size = 0U;
+  uint32_t offset = 0U;
+
+  while ((offset < frame_size) && (status == RBUF_FRAME_DECODED))
+  {
+    uint8_t code = Rbuf_FrameGet(spans, offset);
+    uint32_t run = (uint32_t) code - 1U;
+    bool zero = (code < 0xFFU) && ((offset + code) < frame_size);
+
+    if ((offset + code) > frame_size)
+    {
+      status = RBUF_FRAME_CORRUPTED;
+    }
+    else if ((out_size + run + (zero ? 1U : 0U)) > out_free)
+    {
+      status = RBUF_FRAME_OVERSIZE;
+    }
+    else
+    {
+      Rbuf_FrameCopyOut(spans, offset + 1U, &out[out_size], run);
+      out_size += run;
+      if (zero == true)
+      {
+        out[out_size] = 0U;
+        out_size++;
+      }
+      offset += code;
+    }
+  }
+  if (status == RBUF_FRAME_DECODED)
+  {
+    buf_dst->write_index += (BUF_size_t) out_size;
+  }
+  return status;
+}
+
+/**
+ * \brief Decode one SLIP frame
+ * \param buf_dst Destination buffer
+ * \param spans Ring data from frame start
+ * \param frame_size Encoded size, delimiter excluded
+ * \return Decode status
+ */
+static RBUF_FrameStatus_t Rbuf_SlipDecodeFrame(BUF_t *buf_dst, const RBUF_Span_t spans[2], uint32_t frame_size)
+{
+  RBUF_FrameStatus_t status = RBUF_FRAME_DECODED;
+  uint8_t *out = &buf_dst->data[buf_dst->write_index];
+  uint32_t out_free = BUF_GetFreeSize(buf_dst);
+  uint32_t out_size = 0U;
+  uint32_t offset = 0U;
+
+  while ((offset < frame_size) && (status == RBUF_FRAME_DECODED))
+  {
+    uint32_t escape = Rbuf_FrameFind(spans, offset, frame_size, RBUF_SLIP_ESC);
+    uint32_t run = escape - offset;
+
+    if ((out_size + run + ((escape < frame_size) ? 1U : 0U)) > out_free)
+    {
+      status = RBUF_FRAME_OVERSIZE;
+    }
+    else
+    {
+      Rbuf_FrameCopyOut(spans, offset, &out[out_size], run);
+      out_size += run;
+      offset = escape;
+      if (escape < frame_size)
+      {
+        uint8_t code = ((escape + 1U) < frame_size) ? Rbuf_FrameGet(spans, escape + 1U) : 0U;
+
+        if ((code == RBUF_SLIP_ESC_END) || (code == RBUF_SLIP_ESC_ESC))
+        {
+          out[out_size] = (code == RBUF_SLIP_ESC_END) ? RBUF_SLIP_END : RBUF_SLIP_ESC;
+          out_size++;
+          offset += 2U;
+        }
+        else
+        {
+          status = RBUF_FRAME_CORRUPTED;
+        }
+      }
+    }
+  }
+  if (status == RBUF_FRAME_DECODED)
+  {
+    buf_dst->write_index += (BUF_size_t) out_size;
+  }
+  return status;
+}
+
+/**
+ * \brief Find byte in spans
+ * \param spans Region to search
+ * \param start First offset to check
+ * \param end Past last offset to check
+ * \param value Byte to find
+ * \return Offset of first match, end if none
+ */
+static uint32_t Rbuf_FrameFind(const RBUF_Span_t spans[2], uint32_t start, uint32_t end, uint8_t value)
+{
+  uint32_t found = end;
+  uint32_t end1 = (end < spans[0].size) ? end : spans[0].size;
+
+  if (start < end1)
+  {
+    const uint8_t *match = memchr(&spans[0].data[start], value, end1 - start);
+
+    if (match != NULL)
+    {
+      found = (uint32_t) (match - spans[0].data);
+    }
+  }
+  if ((found == end) && (end > spans[0].size))
+  {
+    uint32_t start2 = (start > spans[0].size) ? (start - spans[0].size) : 0U;
+    const uint8_t *match = memchr(&spans[1].data[start2], value, (end - spans[0].size) - start2);
+
+    if (match != NULL)
+    {
+      found = spans[0].size + (uint32_t) (match - spans[1].data);
+    }
+  }
+  return found;
+}
+
+static uint8_t Rbuf_FrameGet(const RBUF_Span_t spans[2], uint32_t offset)
+{
+  return (offset < spans[0].size) ? spans[0].data[offset] : spans[1].data[offset - spans[0].size];
+}
+
+/**
+ * \brief Copy bytes out of spans
+ * \param spans Source region
+ * \param offset Offset in region
+ * \param data Destination
+ * \param size Size to copy, within region
+ */
+static void Rbuf_FrameCopyOut(const RBUF_Span_t spans[2], uint32_t offset, uint8_t *data, uint32_t size)
+{
+  uint32_t size1 = (offset < spans[0].size) ? (spans[0].size - offset) : 0U;
+
+  size1 = (size1 < size) ? size1 : size;
+  if (size1 > 0U)
+  {
+    memcpy(data, &spans[0].data[offset], size1);
+  }
+  if (size > size1)
+  {
+    memcpy(&data[size1], &spans[1].data[(offset + size1) - spans[0].size], size - size1);
+  }
+}
+
+/**
+ * \brief Copy bytes into spans
+ * \param spans Destination region
+ * \param offset Offset in region
+ * \param data Source
+ * \param size Size to copy, within region
+ */
+static void Rbuf_FrameCopyIn(const RBUF_Span_t spans[2], uint32_t offset, const uint8_t *data, uint32_t size)
+{
+  uint32_t size1 = (offset < spans[0].size) ? (spans[0].size - offset) : 0U;
+
+  size1 = (size1 < size) ? size1 : size;
+  if (size1 > 0U)
+  {
+    memcpy(&spans[0].data[offset], data, size1);
+  }
+  if (size > size1)
+  {
+    memcpy(&spans[1].data[(offset + size1) - spans[0].size], &data[size1], size - size1);
+  }
+}
@@ -0,0 +1,115 @@
+/**
+ * \file ring_buffer_history.c
+ * \brief Sample history ring with contiguous newest window, FIR and dot product kernels
+ * \date 2026-10
+ * \author Nicolas Boutin
+ */
+#if defined(__AVX__) || defined(__SSE__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+#include "ring_buffer/ring_buffer_history.h"
+
+// --- Public functions
+
+void RBUF_HistoryInit(RBUF_History_t *history, float *data, RBUF_size_t capacity)
+{
+  if (history != NULL)
+  {
+    history->data = data;
+    history->capacity = ((data != NULL) && (capacity <= ((RBUF_size_t) ~(RBUF_size_t) 0U / 2U))) ? capacity : 0U;
+    history->index = 0U;
+    history->count = 0U;
+  }
+}
+
+bool RBUF_HistoryPush(RBUF_History_t *history, float sample)
+{
+  bool pushed = false;
+
+  if ((history != NULL) && (history->capacity > 0U))
+  {
+    history->data[history->index] = sample;
+    history->data[history->index + history->capacity] = sample;
+    history->index++;
+    if (history->index == history->capacity)
+    {
+      history->index = 0U;
+    }
+    if (history->count < history->capacity)
+    {
+      history->count++;
+    }
+    pushed = true;
+  }
+  return pushed;
+}
+
+const float *RBUF_HistoryGetWindow(const RBUF_History_t *history, RBUF_size_t length)
+{
+  const float *window = NULL;
+
+  if ((history != NULL) && (length > 0U) && (length <= history->count))
+  {
+    window = &history->data[history->index + history->capacity - length];
+  }
+  return window;
+}
+
+bool RBUF_HistoryFir(const RBUF_History_t *history, const float *taps, RBUF_size_t tap_count, float *output)
+{
+  bool filtered = false;
+  const float *window = RBUF_HistoryGetWindow(history, tap_count);
+
+  if ((window != NULL) && (taps != NULL) && (output != NULL))
+  {
+    *output = RBUF_HistoryDot(window, taps, tap_count);
+    filtered = true;
+  }
+  return filtered;
+}
+
+float RBUF_HistoryDot(const float *a, const float *b, RBUF_size_t length)
+{
+  float sum = 0.0F;
+  RBUF_size_t i = 0U;
+
+  if ((a != NULL) && (b != NULL))
+  {
+#if defined(__AVX__)
+    __m256 acc = _mm256_setzero_ps();
+    for (; (i + 8U) <= length; i += 8U)
+    {
+      acc = _mm256_add_ps(acc, _mm256_mul_ps(_mm256_loadu_ps(&a[i]), _mm256_loadu_ps(&b[i])));
+    }
+    __m128 half = _mm_add_ps(_mm256_castps256_ps128(acc), _mm256_extractf128_ps(acc, 1));
+    half = _mm_add_ps(half, _mm_movehl_ps(half, half));
+    half = _mm_add_ss(half, _mm_shuffle_ps(half, half, 1));
+    sum = _mm_cvtss_f32(half);
+#elif defined(__SSE__)
+    __m128 acc = _mm_setzero_ps();
+    for (; (i + 4U) <= length; i += 4U)
+    {
+      acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(&a[i]), _mm_loadu_ps(&b[i])));
+    }
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 1));
+    sum = _mm_cvtss_f32(acc);
+#elif defined(__ARM_NEON)
+    float32x4_t acc = vdupq_n_f32(0.0F);
+    for (; (i + 4U) <= length; i += 4U)
+    {
+      acc = vmlaq_f32(acc, vld1q_f32(&a[i]), vld1q_f32(&b[i]));
+    }
+    float32x2_t pair = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    sum = vget_lane_f32(vpadd_f32(pair, pair), 0);
+#endif
+    for (; i < length; i++) // Scalar tail, whole vector without SIMD
+    {
+      sum += a[i] * b[i];
+    }
+  }
+  return sum;
+}
@@ -0,0 +1,214 @@
+/**
+ * \file ring_buffer_host.c
+ * \brief Ring Buffer storage on huge pages bound to a NUMA node, Linux hosts
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * getcpu and mbind are called through syscall, no libnuma dependency.
+ */
+#define _GNU_SOURCE
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "ring_buffer/ring_buffer_host.h"
+
+// --- Private constants
+
+#ifndef MPOL_PREFERRED
+#define MPOL_PREFERRED 1
+#endif
+
+#define RBUF_HOST_NODE_MAX 1024 /*!< Nodes covered by the mbind node mask */
+
+// --- Private functions
+
+static void *Rbuf_HostMapHuge(size_t size, size_t *map_size);
+static void *Rbuf_HostMapAligned(size_t size, size_t *map_size);
+static bool Rbuf_HostBind(void *base, size_t size, int node);
+static void Rbuf_HostPrefault(void *base, size_t size, size_t step);
+
+// --- Public functions
+
+int RBUF_HostGetCurrentNode(void)
+{
+  unsigned int cpu = 0U;
+  unsigned int node = 0U;
+
+  if (syscall(SYS_getcpu, &cpu, &node, NULL) != 0)
+  {
+    node = 0U;
+  }
+  return (int) node;
+}
+
+bool RBUF_HostAlloc(RBUF_HostMem_t *mem, size_t size, RBUF_HostPages_t pages, int node)
+{
+  bool allocated = false;
+
+  if ((mem != NULL) && (size > 0U))
+  {
+    size_t step = (size_t) sysconf(_SC_PAGESIZE);
+
+    mem->base = NULL;
+    mem->map_size = 0U;
+    mem->pages = RBUF_HOST_PAGES_DEFAULT;
+    mem->node = RBUF_HOST_NODE_NONE;
+
+    if (pages == RBUF_HOST_PAGES_HUGE)
+    {
+      mem->base = Rbuf_HostMapHuge(size, &mem->map_size);
+      mem->pages = RBUF_HOST_PAGES_HUGE;
+    }
+    if ((mem->base == NULL) && (pages != RBUF_HOST_PAGES_DEFAULT))
+    {
+      mem->base = Rbuf_HostMapAligned(size, &mem->map_size);
+      mem->pages = RBUF_HOST_PAGES_THP;
+      if ((mem->base != NULL) && (madvise(mem->base, mem->map_size, MADV_HUGEPAGE) != 0))
+      {
+        mem->pages = RBUF_HOST_PAGES_DEFAULT; // THP disabled
+      }
+    }
+    if (mem->base == NULL)
+    {
+      mem->map_size = ((size + step - 1U) / step) * step;
+      mem->base = mmap(NULL, mem->map_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      mem->pages = RBUF_HOST_PAGES_DEFAULT;
+      if (mem->base == MAP_FAILED)
+      {
+        mem->base = NULL;
+      }
+    }
+
+    if (mem->base != NULL)
+    {
+      node = (node == RBUF_HOST_NODE_CURRENT) ? RBUF_HostGetCurrentNode() : node;
+      if (Rbuf_HostBind(mem->base, mem->map_size, node) == true)
+      {
+        mem->node = node;
+      }
+      step = (mem->pages == RBUF_HOST_PAGES_DEFAULT) ? step : RBUF_HOST_HUGE_PAGE_SIZE;
+      Rbuf_HostPrefault(mem->base, mem->map_size, step);
+      allocated = true;
+    }
+  }
+  return allocated;
+}
+
+void RBUF_HostFree(RBUF_HostMem_t *mem)
+{
+  if ((mem != NULL) && (mem->base != NULL))
+  {
+    (void) munmap(mem->base, mem->map_size);
+    mem->base = NULL;
+    mem->map_size = 0U;
+  }
+}
+
+bool RBUF_HostCreate(RBUF_t *buffer, RBUF_HostMem_t *mem, RBUF_size_t size, RBUF_HostPages_t pages, int node)
+{
+  bool created = false;
+
+  if ((buffer != NULL) && (RBUF_HostAlloc(mem, size, pages, node) == true))
+  {
+    RBUF_InitEmpty(buffer, (uint8_t *) mem->base, size);
+    created = true;
+  }
+  return created;
+}
+
+// --- Private functions
+
+/**
+ * \brief Map explicit huge pages
+ * \param size Storage size
+ * \param map_size Mapped size
+ * \return Mapping, NULL if no huge page is reserved
+ */
+static void *Rbuf_HostMapHuge(size_t size, size_t *map_size)
+{
+  void *base = NULL;
+#ifdef MAP_HUGETLB
+  size_t huge_size = ((size + RBUF_HOST_HUGE_PAGE_SIZE - 1U) / RBUF_HOST_HUGE_PAGE_SIZE) * RBUF_HOST_HUGE_PAGE_SIZE;
+
+  base = mmap(NULL, huge_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+  if (base == MAP_FAILED)
+  {
+    base = NULL;
+  }
+  else
+  {
+    *map_size = huge_size;
+  }
+#else
+  (void) size;
+  (void) map_size;
+#endif
+  return base;
+}
+
+/**
+ * \brief Map regular pages on a huge page aligned range, so THP can back all of it
+ * \param size Storage size
+ * \param map_size Mapped size, multiple of the huge page size
+ * \return Mapping, NULL on failure
+ */
+static void *Rbuf_HostMapAligned(size_t size, size_t *map_size)
+{
+  void *base = NULL;
+  size_t huge_size = ((size + RBUF_HOST_HUGE_PAGE_SIZE - 1U) / RBUF_HOST_HUGE_PAGE_SIZE) * RBUF_HOST_HUGE_PAGE_SIZE;
+  uint8_t *raw = mmap(NULL, huge_size + RBUF_HOST_HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+                      -1, 0);
+
+  if (raw != MAP_FAILED)
+  {
+    size_t head = (RBUF_HOST_HUGE_PAGE_SIZE - ((uintptr_t) raw % RBUF_HOST_HUGE_PAGE_SIZE)) % RBUF_HOST_HUGE_PAGE_SIZE;
+
+    if (head > 0U)
+    {
+      (void) munmap(raw, head);
+    }
+    (void) munmap(raw + head + huge_size, RBUF_HOST_HUGE_PAGE_SIZE - head);
+    base = raw + head;
+    *map_size = huge_size;
+  }
+  return base;
+}
+
+/**
+ * \brief Prefer pages of one node for a range not touched yet
+ * \param base Range start
+ * \param size Range size
+ * \param node Node, RBUF_HOST_NODE_NONE to skip
+ * \return true if bound, false otherwise
+ */
+static bool Rbuf_HostBind(void *base, size_t size, int node)
+{
+  bool bound = false;
+
+  if ((node >= 0) && (node < RBUF_HOST_NODE_MAX))
+  {
+    unsigned long mask[RBUF_HOST_NODE_MAX / (8U * sizeof(unsigned long))] = {0};
+
+    mask[(size_t) node / (8U * sizeof(unsigned long))] = 1UL << ((size_t) node % (8U * sizeof(unsigned long)));
+    bound = (syscall(SYS_mbind, base, size, MPOL_PREFERRED, mask, (unsigned long) RBUF_HOST_NODE_MAX, 0U) == 0);
+  }
+  return bound;
+}
+
+/**
+ * \brief Touch every page so it is allocated now, on the bound node, not in the data path
+ * \param base Range start
+ * \param size Range size
+ * \param step Page size
+ */
+static void Rbuf_HostPrefault(void *base, size_t size, size_t step)
+{
+  volatile uint8_t *bytes = (volatile uint8_t *) base;
+
+  for (size_t offset = 0U; offset < size; offset += step)
+  {
+    bytes[offset] = 0U;
+  }
+}
@@ -0,0 +1,249 @@
+/**
+ * \file ring_buffer_latency.c
+ * \brief Ring Buffer residency time measurement, built with RBUF_CFG_LATENCY
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Byte counts are derived from ring index moves since the last call, so
+ * every write and read path of the ring is covered through its signal
+ * functions. Positions are free running 32 bit counters compared modulo
+ * 2^32.
+ */
+#include "ring_buffer/ring_buffer_latency.h"
+
+// --- Private constants
+
+#define RBUF_LATENCY_SUB_COUNT (1UL << RBUF_LATENCY_SUB_BITS)
+
+// --- Private functions
+
+static RBUF_size_t Rbuf_LatencyDistance(const RBUF_t *buffer, RBUF_size_t from, RBUF_size_t to);
+static uint16_t Rbuf_LatencyMsb(uint32_t value);
+static uint16_t Rbuf_LatencyBucket(uint32_t value);
+static uint32_t Rbuf_LatencyBucketHighest(uint16_t bucket);
+static void Rbuf_LatencyRecord(RBUF_Latency_t *latency, uint32_t value);
+
+// --- Public functions
+
+void RBUF_LatencyInit(RBUF_Latency_t *latency, RBUF_LatencySample_t *samples, uint16_t sample_capacity,
+                      uint32_t period, RBUF_ClockFn_t clock, void *context)
+{
+  if (latency != NULL)
+  {
+    latency->clock = clock;
+    latency->context = context;
+    latency->period = period;
+    latency->written = 0U;
+    latency->read = 0U;
+    latency->next_sample = 0U;
+    latency->write_index = 0U;
+    latency->read_index = 0U;
+    latency->samples = samples;
+    latency->sample_capacity = (samples != NULL) ? sample_capacity : 0U;
+    latency->sample_head = 0U;
+    latency->sample_count = 0U;
+    latency->dropped = 0U;
+    RBUF_LatencyReset(latency);
+  }
+}
+
+bool RBUF_LatencyAttach(RBUF_t *buffer, RBUF_Latency_t *latency)
+{
+  bool attached = false;
+
+  if ((buffer != NULL) && (latency != NULL) && (latency->clock != NULL) && (latency->sample_capacity > 0U))
+  {
+    latency->write_index = buffer->write_index;
+    latency->read_index = buffer->read_index;
+    latency->read = latency->written - RBUF_GetUsedSize(buffer); // Unsampled backlog
+    latency->next_sample = latency->written;
+    latency->sample_head = 0U;
+    latency->sample_count = 0U;
+    buffer->latency = latency;
+    buffer->hooks |= RBUF_HOOK_LATENCY;
+    attached = true;
+  }
+  return attached;
+}
+
+void RBUF_LatencyDetach(RBUF_t *buffer)
+{
+  if (buffer != NULL)
+  {
+    buffer->latency = NULL;
+    buffer->hooks &= (uint8_t) ~RBUF_HOOK_LATENCY;
+  }
+}
+
+void RBUF_LatencyReset(RBUF_Latency_t *latency)
+{
+  if (latency != NULL)
+  {
+    latency->count = 0U;
+    latency->max = 0U;
+    for (uint16_t bucket = 0U; bucket < RBUF_LATENCY_BUCKET_COUNT; bucket++)
+    {
+      latency->buckets[bucket] = 0U;
+    }
+  }
+}
+
+uint32_t RBUF_LatencyGetQuantile(const RBUF_Latency_t *latency, uint16_t per_mille)
+{
+  uint32_t value = 0U;
+
+  if ((latency != NULL) && (latency->count > 0U))
+  {
+    uint64_t rank = (((uint64_t) latency->count * ((per_mille < 1000U) ? per_mille : 1000U)) + 999U) / 1000U;
+    uint64_t seen = 0U;
+    uint16_t bucket = 0U;
+
+    rank = (rank > 0U) ? rank : 1U;
+    while ((seen + latency->buckets[bucket]) < rank)
+    {
+      seen += latency->buckets[bucket];
+      bucket++;
+    }
+    value = Rbuf_LatencyBucketHighest(bucket);
+    value = (value < latency->max) ? value : latency->max;
+  }
+  return value;
+}
+
+void RBUF_LatencyGetSummary(const RBUF_Latency_t *latency, RBUF_LatencySummary_t *summary)
+{
+  if ((latency != NULL) && (summary != NULL))
+  {
+    summary->count = latency->count;
+    summary->p50 = RBUF_LatencyGetQuantile(latency, 500U);
+    summary->p99 = RBUF_LatencyGetQuantile(latency, 990U);
+    summary->max = latency->max;
+  }
+}
+
+void RBUF_LatencyOnWrite(RBUF_t *buffer)
+{
+  RBUF_Latency_t *latency = buffer->latency;
+  RBUF_size_t size = Rbuf_LatencyDistance(buffer, latency->write_index, buffer->write_index);
+  uint32_t end = latency->written + size;
+
+  if ((size > 0U) && ((int32_t) (end - latency->next_sample) > 0))
+  {
+    uint32_t position = (latency->period == RBUF_LATENCY_PER_WRITE) ? latency->written : latency->next_sample;
+
+    if (latency->sample_count < latency->sample_capacity)
+    {
+      uint16_t slot = (uint16_t) ((latency->sample_head + latency->sample_count) % latency->sample_capacity);
+
+      latency->samples[slot].position = position;
+      latency->samples[slot].time = latency->clock(latency->context);
+      latency->sample_count++;
+    }
+    else
+    {
+      latency->dropped++;
+    }
+    /* At most one sample per write, next one on the first period boundary past this write */
+    if (latency->period != RBUF_LATENCY_PER_WRITE)
+    {
+      latency->next_sample += (((end - latency->next_sample) + latency->period - 1U) / latency->period) * latency->period;
+    }
+    else
+    {
+      latency->next_sample = end;
+    }
+  }
+  latency->written = end;
+  latency->write_index = buffer->write_index;
+}
+
+void RBUF_LatencyOnRead(RBUF_t *buffer)
+{
+  RBUF_Latency_t *latency = buffer->latency;
+
+  latency->read += Rbuf_LatencyDistance(buffer, latency->read_index, buffer->read_index);
+  latency->read_index = buffer->read_index;
+  if ((latency->sample_count > 0U)
+      && ((int32_t) (latency->read - latency->samples[latency->sample_head].position) > 0))
+  {
+    uint32_t now = latency->clock(latency->context);
+
+    while ((latency->sample_count > 0U)
+           && ((int32_t) (latency->read - latency->samples[latency->sample_head].position) > 0))
+    {
+      Rbuf_LatencyRecord(latency, now - latency->samples[latency->sample_head].time);
+      latency->sample_head = (uint16_t) ((latency->sample_head + 1U) % latency->sample_capacity);
+      latency->sample_count--;
+    }
+  }
+}
+
+void RBUF_LatencyOnMove(RBUF_t *buffer)
+{
+  RBUF_Latency_t *latency = buffer->latency;
+
+  latency->write_index = buffer->write_index;
+  latency->read_index = buffer->read_index;
+}
+
+// --- Private functions
+
+static RBUF_size_t Rbuf_LatencyDistance(const RBUF_t *buffer, RBUF_size_t from, RBUF_size_t to)
+{
+  return (RBUF_size_t) ((to >= from) ? (to - from) : ((buffer->size - from) + to));
+}
+
+static uint16_t Rbuf_LatencyMsb(uint32_t value)
+{
+#if defined(__GNUC__)
+  return (uint16_t) (31U - (uint32_t) __builtin_clz(value));
+#else
+  uint16_t msb = 0U;
+
+  while ((value >> 1U) != 0U)
+  {
+    value >>= 1U;
+    msb++;
+  }
+  return msb;
+#endif
+}
+
+/**
+ * \brief Get bucket of a value, linear below 2^RBUF_LATENCY_SUB_BITS then log-linear
+ * \param value Value to classify
+ * \return Bucket index
+ */
+static uint16_t Rbuf_LatencyBucket(uint32_t value)
+{
+  uint16_t bucket = (uint16_t) value;
+
+  if (value >= RBUF_LATENCY_SUB_COUNT)
+  {
+    uint16_t group = (uint16_t) (Rbuf_LatencyMsb(value) - RBUF_LATENCY_SUB_BITS + 1U);
+
+    bucket = (uint16_t) ((group << RBUF_LATENCY_SUB_BITS) + ((value >> (group - 1U)) - RBUF_LATENCY_SUB_COUNT));
+  }
+  return bucket;
+}
+
+static uint32_t Rbuf_LatencyBucketHighest(uint16_t bucket)
+{
+  uint32_t highest = bucket;
+
+  if (bucket >= RBUF_LATENCY_SUB_COUNT)
+  {
+    uint16_t group = (uint16_t) (bucket >> RBUF_LATENCY_SUB_BITS);
+    uint64_t lowest = (uint64_t) (RBUF_LATENCY_SUB_COUNT + (bucket & (RBUF_LATENCY_SUB_COUNT - 1U))) << (group - 1U);
+
+    highest = (uint32_t) (lowest + (1ULL << (group - 1U)) - 1U);
+  }
+  return highest;
+}
+
+static void Rbuf_LatencyRecord(RBUF_Latency_t *latency, uint32_t value)
+{
+  latency->buckets[Rbuf_LatencyBucket(value)]++;
+  latency->count++;
+  latency->max = (value > latency->max) ? value : latency->max;
+}
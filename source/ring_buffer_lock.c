@@ -0,0 +1,352 @@
+/**
+ * \file ring_buffer_lock.c
+ * \brief Ring Buffer with a concurrency policy chosen at init
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Copies run on a view of the ring detached from its ring set and
+ * watermark. The shared ring is notified in the critical section that
+ * publishes the new index, so notifications from the writer and the reader
+ * never interleave on the watermark state.
+ */
+#include <stdatomic.h>
+
+#include "ring_buffer/ring_buffer_lock.h"
+
+// --- Private functions
+
+static void Rbuf_LockEnter(const RBUF_Lock_t *lock);
+static void Rbuf_LockExit(const RBUF_Lock_t *lock);
+static void Rbuf_LockSnapshot(RBUF_Locked_t *locked, RBUF_t *view);
+static void Rbuf_LockPublishWrite(RBUF_Locked_t *locked, const RBUF_t *view);
+static void Rbuf_LockPublishRead(RBUF_Locked_t *locked, const RBUF_t *view);
+static void Rbuf_SpinEnter(void *context);
+static void Rbuf_SpinExit(void *context);
+
+// --- Public functions
+
+void RBUF_LockInitNone(RBUF_Lock_t *lock)
+{
+  RBUF_LockInitHooks(lock, NULL, NULL, NULL);
+}
+
+void RBUF_LockInitHooks(RBUF_Lock_t *lock, RBUF_LockFn_t enter, RBUF_LockFn_t exit, void *context)
+{
+  if (lock != NULL)
+  {
+    lock->enter = enter;
+    lock->exit = exit;
+    lock->context = context;
+  }
+}
+
+void RBUF_LockInitSpin(RBUF_Lock_t *lock, RBUF_Spinlock_t *spinlock)
+{
+  if ((lock != NULL) && (spinlock != NULL))
+  {
+    atomic_store_explicit((_Atomic uint32_t *) &spinlock->flag, 0U, memory_order_release);
+    RBUF_LockInitHooks(lock, Rbuf_SpinEnter, Rbuf_SpinExit, spinlock);
+  }
+}
+
+void RBUF_LockedInit(RBUF_Locked_t *locked, uint8_t *data, RBUF_size_t size, const RBUF_Lock_t *lock)
+{
+  if (locked != NULL)
+  {
+    RBUF_InitEmpty(&locked->ring, data, size);
+    RBUF_LockInitNone(&locked->lock);
+    if (lock != NULL)
+    {
+      locked->lock = *lock;
+    }
+  }
+}
+
+RBUF_size_t RBUF_LockedGetUsedSize(RBUF_Locked_t *locked)
+{
+  RBUF_size_t used_size = 0U;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    used_size = RBUF_GetUsedSize(&view);
+  }
+  return used_size;
+}
+
+RBUF_size_t RBUF_LockedGetFreeSize(RBUF_Locked_t *locked)
+{
+  RBUF_size_t free_size = 0U;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    free_size = RBUF_GetFreeSize(&view);
+  }
+  return free_size;
+}
+
+bool RBUF_LockedWriteString(RBUF_Locked_t *locked, const char *data, RBUF_size_t size)
+{
+  bool written = false;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    written = RBUF_WriteString(&view, data, size);
+    if (written == true)
+    {
+      Rbuf_LockPublishWrite(locked, &view);
+    }
+  }
+  return written;
+}
+
+bool RBUF_LockedWriteUint8(RBUF_Locked_t *locked, uint8_t data)
+{
+  bool written = false;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    written = RBUF_WriteUint8(&view, data);
+    if (written == true)
+    {
+      Rbuf_LockPublishWrite(locked, &view);
+    }
+  }
+  return written;
+}
+
+bool RBUF_LockedWriteUint16(RBUF_Locked_t *locked, uint16_t data)
+{
+  bool written = false;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    written = RBUF_WriteUint16(&view, data);
+    if (written == true)
+    {
+      Rbuf_LockPublishWrite(locked, &view);
+    }
+  }
+  return written;
+}
+
+bool RBUF_LockedWriteUint32(RBUF_Locked_t *locked, uint32_t data)
+{
+  bool written = false;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    written = RBUF_WriteUint32(&view, data);
+    if (written == true)
+    {
+      Rbuf_LockPublishWrite(locked, &view);
+    }
+  }
+  return written;
+}
+
+uint8_t RBUF_LockedReadUint8(RBUF_Locked_t *locked)
+{
+  uint8_t data = 0U;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    if (RBUF_GetUsedSize(&view) >= 1U)
+    {
+      data = RBUF_ReadUint8(&view);
+      Rbuf_LockPublishRead(locked, &view);
+    }
+  }
+  return data;
+}
+
+bool RBUF_LockedReadCopyBlock(BUF_t *buf_dst, RBUF_Locked_t *locked, RBUF_size_t size)
+{
+  bool read = false;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    read = RBUF_ReadCopyBlock(buf_dst, &view, size);
+    if (read == true)
+    {
+      Rbuf_LockPublishRead(locked, &view);
+    }
+  }
+  return read;
+}
+
+RBUF_size_t RBUF_LockedReadCopyRaw(BUF_t *buf_dst, RBUF_Locked_t *locked, RBUF_size_t size)
+{
+  RBUF_size_t read = 0U;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    read = RBUF_ReadCopyRaw(buf_dst, &view, size);
+    if (read > 0U)
+    {
+      Rbuf_LockPublishRead(locked, &view);
+    }
+  }
+  return read;
+}
+
+RBUF_size_t RBUF_LockedWriteReserve(RBUF_Locked_t *locked, RBUF_Span_t spans[2])
+{
+  RBUF_size_t free_size = 0U;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    free_size = RBUF_WriteReserve(&view, spans);
+  }
+  return free_size;
+}
+
+bool RBUF_LockedWriteCommit(RBUF_Locked_t *locked, RBUF_size_t size)
+{
+  bool committed = false;
+
+  if (locked != NULL)
+  {
+    Rbuf_LockEnter(&locked->lock);
+    committed = RBUF_WriteCommit(&locked->ring, size);
+    Rbuf_LockExit(&locked->lock);
+  }
+  return committed;
+}
+
+RBUF_size_t RBUF_LockedReadPeek(RBUF_Locked_t *locked, RBUF_Span_t spans[2])
+{
+  RBUF_size_t used_size = 0U;
+
+  if (locked != NULL)
+  {
+    RBUF_t view;
+
+    Rbuf_LockSnapshot(locked, &view);
+    used_size = RBUF_ReadPeek(&view, spans);
+  }
+  return used_size;
+}
+
+bool RBUF_LockedReadCommit(RBUF_Locked_t *locked, RBUF_size_t size)
+{
+  bool committed = false;
+
+  if (locked != NULL)
+  {
+    Rbuf_LockEnter(&locked->lock);
+    committed = RBUF_ReadCommit(&locked->ring, size);
+    Rbuf_LockExit(&locked->lock);
+  }
+  return committed;
+}
+
+// --- Private functions
+
+static void Rbuf_LockEnter(const RBUF_Lock_t *lock)
+{
+  if (lock->enter != NULL)
+  {
+    lock->enter(lock->context);
+  }
+}
+
+static void Rbuf_LockExit(const RBUF_Lock_t *lock)
+{
+  if (lock->exit != NULL)
+  {
+    lock->exit(lock->context);
+  }
+}
+
+/**
+ * \brief Copy shared ring indexes into a private view, detached from ring set, watermark and monitor
+ * \param locked Shared ring
+ * \param view Private view
+ */
+static void Rbuf_LockSnapshot(RBUF_Locked_t *locked, RBUF_t *view)
+{
+  Rbuf_LockEnter(&locked->lock);
+  *view = locked->ring;
+  Rbuf_LockExit(&locked->lock);
+  view->ready_word = NULL;
+  view->ready_mask = 0U;
+  view->watermark = NULL;
+  view->monitor = NULL;
+#ifdef RBUF_CFG_LATENCY
+  view->latency = NULL;
+#endif
+  view->hooks = 0U;
+}
+
+/**
+ * \brief Publish the write index of a view and notify the shared ring, in one critical section
+ * \param locked Shared ring
+ * \param view Private view written to
+ */
+static void Rbuf_LockPublishWrite(RBUF_Locked_t *locked, const RBUF_t *view)
+{
+  Rbuf_LockEnter(&locked->lock);
+  locked->ring.write_index = view->write_index;
+  RBUF_NotifyWrite(&locked->ring);
+  Rbuf_LockExit(&locked->lock);
+}
+
+/**
+ * \brief Publish the read index of a view and notify the shared ring, in one critical section
+ * \param locked Shared ring
+ * \param view Private view read from
+ */
+static void Rbuf_LockPublishRead(RBUF_Locked_t *locked, const RBUF_t *view)
+{
+  Rbuf_LockEnter(&locked->lock);
+  locked->ring.read_index = view->read_index;
+  RBUF_NotifyRead(&locked->ring);
+  Rbuf_LockExit(&locked->lock);
+}
+
+static void Rbuf_SpinEnter(void *context)
+{
+  _Atomic uint32_t *flag = (_Atomic uint32_t *) &((RBUF_Spinlock_t *) context)->flag;
+
+  while (atomic_exchange_explicit(flag, 1U, memory_order_acquire) != 0U)
+  {
+    while (atomic_load_explicit(flag, memory_order_relaxed) != 0U) // Wait on a shared cache line
+    {
+    }
+  }
+}
+
+static void Rbuf_SpinExit(void *context)
+{
+  atomic_store_explicit((_Atomic uint32_t *) &((RBUF_Spinlock_t *) context)->flag, 0U, memory_order_release);
+}
@@ -0,0 +1,34 @@
+/**
+ * \file ring_buffer_lock_mutex.c
+ * \brief pthread mutex concurrency policy for RBUF_Locked_t
+ * \date 2026-10
+ * \author Nicolas Boutin
+ */
+#include "ring_buffer/ring_buffer_lock_mutex.h"
+
+// --- Private functions
+
+static void Rbuf_MutexEnter(void *context);
+static void Rbuf_MutexExit(void *context);
+
+// --- Public functions
+
+void RBUF_LockInitMutex(RBUF_Lock_t *lock, pthread_mutex_t *mutex)
+{
+  if ((lock != NULL) && (mutex != NULL))
+  {
+    RBUF_LockInitHooks(lock, Rbuf_MutexEnter, Rbuf_MutexExit, mutex);
+  }
+}
+
+// --- Private functions
+
+static void Rbuf_MutexEnter(void *context)
+{
+  (void) pthread_mutex_lock((pthread_mutex_t *) context);
+}
+
+static void Rbuf_MutexExit(void *context)
+{
+  (void) pthread_mutex_unlock((pthread_mutex_t *) context);
+}
@@ -0,0 +1,196 @@
+/**
+ * \file ring_buffer_monitor.c
+ * \brief Consistent Ring Buffer state snapshot for monitoring
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Each side is a seqlock with a single updater. Both sides are read inside
+ * the window where neither counter moved, read side counter loaded first and
+ * last, so the pair existed at one instant. Published indexes trail the ring
+ * by the end of the operation: a read whose writer has not published yet
+ * shows as the reader ahead of the writer and is retried.
+ */
+#include <stdatomic.h>
+
+#include "ring_buffer/ring_buffer_monitor.h"
+
+// --- Private functions
+
+static uint32_t Rbuf_MonitorLoad(const uint32_t *field, memory_order order);
+static void Rbuf_MonitorStore(uint32_t *field, uint32_t value, memory_order order);
+static uint32_t Rbuf_MonitorDistance(const RBUF_Monitor_t *monitor, uint32_t from, uint32_t to);
+static uint32_t Rbuf_MonitorBegin(RBUF_MonitorSide_t *side);
+static void Rbuf_MonitorEnd(RBUF_MonitorSide_t *side, uint32_t sequence);
+
+// --- Public functions
+
+bool RBUF_MonitorAttach(RBUF_t *buffer, RBUF_Monitor_t *monitor)
+{
+  bool attached = false;
+
+  if ((buffer != NULL) && (buffer->size > 0U) && (monitor != NULL))
+  {
+    RBUF_MonitorSide_t *sides[2] = {&monitor->write, &monitor->read};
+
+    for (uint8_t i = 0U; i < 2U; i++)
+    {
+      Rbuf_MonitorStore(&sides[i]->sequence, 0U, memory_order_relaxed);
+      Rbuf_MonitorStore(&sides[i]->bytes, 0U, memory_order_relaxed);
+      Rbuf_MonitorStore(&sides[i]->count, 0U, memory_order_relaxed);
+    }
+    Rbuf_MonitorStore(&monitor->write.index, buffer->write_index, memory_order_relaxed);
+    Rbuf_MonitorStore(&monitor->read.index, buffer->read_index, memory_order_relaxed);
+    Rbuf_MonitorStore(&monitor->peak, RBUF_GetUsedSize(buffer), memory_order_relaxed);
+    monitor->backlog = RBUF_GetUsedSize(buffer);
+    Rbuf_MonitorStore(&monitor->size, buffer->size, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    buffer->monitor = monitor;
+    buffer->hooks |= RBUF_HOOK_MONITOR;
+    attached = true;
+  }
+  return attached;
+}
+
+void RBUF_MonitorDetach(RBUF_t *buffer)
+{
+  if (buffer != NULL)
+  {
+    buffer->monitor = NULL;
+    buffer->hooks &= (uint8_t) ~RBUF_HOOK_MONITOR;
+  }
+}
+
+bool RBUF_MonitorSnapshot(const RBUF_Monitor_t *monitor, RBUF_Snapshot_t *snapshot, uint16_t retries)
+{
+  bool taken = false;
+
+  if ((monitor != NULL) && (snapshot != NULL))
+  {
+    uint32_t attempts = (uint32_t) retries + 1U;
+
+    while ((taken == false) && (attempts > 0U))
+    {
+      uint32_t read_sequence = Rbuf_MonitorLoad(&monitor->read.sequence, memory_order_acquire);
+      uint32_t write_sequence = Rbuf_MonitorLoad(&monitor->write.sequence, memory_order_acquire);
+      uint32_t read_index = Rbuf_MonitorLoad(&monitor->read.index, memory_order_relaxed);
+      uint32_t read = Rbuf_MonitorLoad(&monitor->read.bytes, memory_order_relaxed);
+      uint32_t reads = Rbuf_MonitorLoad(&monitor->read.count, memory_order_relaxed);
+      uint32_t write_index = Rbuf_MonitorLoad(&monitor->write.index, memory_order_relaxed);
+      uint32_t written = Rbuf_MonitorLoad(&monitor->write.bytes, memory_order_relaxed);
+      uint32_t writes = Rbuf_MonitorLoad(&monitor->write.count, memory_order_relaxed);
+      uint32_t peak = Rbuf_MonitorLoad(&monitor->peak, memory_order_relaxed);
+      uint32_t size = Rbuf_MonitorLoad(&monitor->size, memory_order_relaxed);
+
+      atomic_thread_fence(memory_order_acquire);
+      if (((read_sequence & 1U) == 0U) && ((write_sequence & 1U) == 0U)
+          && (Rbuf_MonitorLoad(&monitor->write.sequence, memory_order_relaxed) == write_sequence)
+          && (Rbuf_MonitorLoad(&monitor->read.sequence, memory_order_relaxed) == read_sequence))
+      {
+        uint32_t used_size = (monitor->backlog + written) - read; /* Wraps above capacity if reader is ahead */
+
+        if (used_size < size)
+        {
+          snapshot->read_index = (RBUF_size_t) read_index;
+          snapshot->write_index = (RBUF_size_t) write_index;
+          snapshot->used_size = (RBUF_size_t) used_size;
+          snapshot->free_size = (RBUF_size_t) (size - 1U - used_size);
+          snapshot->peak = (RBUF_size_t) peak;
+          snapshot->written = written;
+          snapshot->read = read;
+          snapshot->writes = writes;
+          snapshot->reads = reads;
+          taken = true;
+        }
+      }
+      attempts--;
+    }
+  }
+  return taken;
+}
+
+void RBUF_MonitorOnWrite(RBUF_t *buffer)
+{
+  RBUF_Monitor_t *monitor = buffer->monitor;
+  uint32_t sequence = Rbuf_MonitorBegin(&monitor->write);
+  uint32_t index = buffer->write_index;
+  uint32_t bytes = Rbuf_MonitorDistance(monitor, monitor->write.index, index);
+  uint32_t used_size = Rbuf_MonitorDistance(monitor, buffer->read_index, index);
+
+  Rbuf_MonitorStore(&monitor->write.index, index, memory_order_relaxed);
+  Rbuf_MonitorStore(&monitor->write.bytes, monitor->write.bytes + bytes, memory_order_relaxed);
+  Rbuf_MonitorStore(&monitor->write.count, monitor->write.count + 1U, memory_order_relaxed);
+  if (used_size > monitor->peak)
+  {
+    Rbuf_MonitorStore(&monitor->peak, used_size, memory_order_relaxed);
+  }
+  Rbuf_MonitorEnd(&monitor->write, sequence);
+}
+
+void RBUF_MonitorOnRead(RBUF_t *buffer)
+{
+  RBUF_Monitor_t *monitor = buffer->monitor;
+  uint32_t sequence = Rbuf_MonitorBegin(&monitor->read);
+  uint32_t index = buffer->read_index;
+  uint32_t bytes = Rbuf_MonitorDistance(monitor, monitor->read.index, index);
+
+  Rbuf_MonitorStore(&monitor->read.index, index, memory_order_relaxed);
+  Rbuf_MonitorStore(&monitor->read.bytes, monitor->read.bytes + bytes, memory_order_relaxed);
+  Rbuf_MonitorStore(&monitor->read.count, monitor->read.count + 1U, memory_order_relaxed);
+  Rbuf_MonitorEnd(&monitor->read, sequence);
+}
+
+void RBUF_MonitorOnMove(RBUF_t *buffer)
+{
+  RBUF_Monitor_t *monitor = buffer->monitor;
+  uint32_t write_sequence = Rbuf_MonitorBegin(&monitor->write);
+  uint32_t read_sequence = Rbuf_MonitorBegin(&monitor->read);
+
+  Rbuf_MonitorStore(&monitor->write.index, buffer->write_index, memory_order_relaxed);
+  Rbuf_MonitorStore(&monitor->read.index, buffer->read_index, memory_order_relaxed);
+  Rbuf_MonitorStore(&monitor->size, buffer->size, memory_order_relaxed);
+  Rbuf_MonitorEnd(&monitor->read, read_sequence);
+  Rbuf_MonitorEnd(&monitor->write, write_sequence);
+}
+
+// --- Private functions
+
+static uint32_t Rbuf_MonitorLoad(const uint32_t *field, memory_order order)
+{
+  return atomic_load_explicit((_Atomic uint32_t *) field, order);
+}
+
+static void Rbuf_MonitorStore(uint32_t *field, uint32_t value, memory_order order)
+{
+  atomic_store_explicit((_Atomic uint32_t *) field, value, order);
+}
+
+/**
+ * \brief Get bytes from one ring index to another
+ * \param monitor Monitor holding ring size
+ * \param from Start index
+ * \param to End index
+ * \return Distance, lower than ring size
+ */
+static uint32_t Rbuf_MonitorDistance(const RBUF_Monitor_t *monitor, uint32_t from, uint32_t to)
+{
+  return (to >= from) ? (to - from) : ((monitor->size - from) + to);
+}
+
+/**
+ * \brief Mark side as updating
+ * \param side Side owned by the caller
+ * \return Sequence to pass to Rbuf_MonitorEnd
+ */
+static uint32_t Rbuf_MonitorBegin(RBUF_MonitorSide_t *side)
+{
+  uint32_t sequence = Rbuf_MonitorLoad(&side->sequence, memory_order_relaxed) + 1U;
+
+  Rbuf_MonitorStore(&side->sequence, sequence, memory_order_relaxed);
+  atomic_thread_fence(memory_order_release); /* Odd sequence visible before any field */
+  return sequence;
+}
+
+static void Rbuf_MonitorEnd(RBUF_MonitorSide_t *side, uint32_t sequence)
+{
+  Rbuf_MonitorStore(&side->sequence, sequence + 1U, memory_order_release);
+}
@@ -0,0 +1,210 @@
+/**
+ * \file ring_buffer_mux.c
+ * \brief Logical channels multiplexed over one Ring Buffer
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Records are written in place past the write index and committed once.
+ * Channel usage is written minus read bytes, each counter owned by one side.
+ * A record with an unknown channel or a size past the used data can only
+ * come from a corrupted ring, the whole content is then dropped.
+ */
+#include <string.h>
+
+#include "ring_buffer/ring_buffer_mux.h"
+
+// --- Private functions
+
+static bool Rbuf_MuxIsChannel(const RBUF_Mux_t *mux, uint8_t channel);
+static bool Rbuf_MuxIsPayloadSize(RBUF_size_t size);
+static uint8_t Rbuf_MuxPeek(const RBUF_t *ring, uint32_t offset);
+static void Rbuf_MuxPut(RBUF_t *ring, uint32_t offset, const uint8_t *data, uint32_t size);
+
+// --- Public functions
+
+void RBUF_MuxInit(RBUF_Mux_t *mux, uint8_t *data, RBUF_size_t size, RBUF_MuxChannel_t *channels,
+                  uint8_t channel_count)
+{
+  if (mux != NULL)
+  {
+    RBUF_InitEmpty(&mux->ring, data, size);
+    mux->channels = channels;
+    mux->channel_count = (channels != NULL) ? channel_count : 0U;
+    for (uint8_t channel = 0U; channel < mux->channel_count; channel++)
+    {
+      channels[channel].quota = (size > 0U) ? (RBUF_size_t) (size - 1U) : 0U;
+      channels[channel].written = 0U;
+      channels[channel].read = 0U;
+      channels[channel].dropped = 0U;
+      channels[channel].refused = 0U;
+      channels[channel].handler = NULL;
+      channels[channel].context = NULL;
+    }
+  }
+}
+
+bool RBUF_MuxSetChannel(RBUF_Mux_t *mux, uint8_t channel, RBUF_size_t quota, RBUF_MuxHandler_t handler,
+                        void *context)
+{
+  bool set = false;
+
+  if (Rbuf_MuxIsChannel(mux, channel) == true)
+  {
+    mux->channels[channel].quota = quota;
+    mux->channels[channel].handler = handler;
+    mux->channels[channel].context = context;
+    set = true;
+  }
+  return set;
+}
+
+bool RBUF_MuxWrite(RBUF_Mux_t *mux, uint8_t channel, const uint8_t *data, RBUF_size_t size)
+{
+  bool written = false;
+
+  if ((Rbuf_MuxIsChannel(mux, channel) == true) && (mux->ring.data != NULL) && ((data != NULL) || (size == 0U))
+      && (Rbuf_MuxIsPayloadSize(size) == true))
+  {
+    RBUF_MuxChannel_t *state = &mux->channels[channel];
+    uint32_t record_size = RBUF_MUX_RECORD_SIZE((uint32_t) size);
+
+    if (((uint32_t) RBUF_MuxGetUsedSize(mux, channel) + record_size) > state->quota)
+    {
+      state->refused++;
+    }
+    else if (record_size <= RBUF_GetFreeSize(&mux->ring))
+    {
+      uint8_t header[RBUF_MUX_HEADER_SIZE] = {channel, (uint8_t) (size >> 8U), (uint8_t) (size & 0x00FFU)};
+
+      Rbuf_MuxPut(&mux->ring, 0U, header, RBUF_MUX_HEADER_SIZE);
+      Rbuf_MuxPut(&mux->ring, RBUF_MUX_HEADER_SIZE, data, size);
+      written = RBUF_WriteCommit(&mux->ring, (RBUF_size_t) record_size);
+      state->written += record_size;
+    }
+    else
+    {
+      /* Ring full, quotas larger than the ring share */
+    }
+  }
+  return written;
+}
+
+RBUF_size_t RBUF_MuxDispatch(RBUF_Mux_t *mux, RBUF_size_t max_records)
+{
+  RBUF_size_t count = 0U;
+
+  if ((mux != NULL) && (mux->ring.data != NULL))
+  {
+    RBUF_t *ring = &mux->ring;
+    bool more = true;
+
+    while ((count < max_records) && (more == true))
+    {
+      RBUF_size_t used_size = RBUF_GetUsedSize(ring);
+
+      more = (used_size >= RBUF_MUX_HEADER_SIZE);
+      if (more == true)
+      {
+        uint8_t channel = Rbuf_MuxPeek(ring, 0U);
+        uint32_t size = ((uint32_t) Rbuf_MuxPeek(ring, 1U) << 8U) | Rbuf_MuxPeek(ring, 2U);
+        uint32_t record_size = RBUF_MUX_RECORD_SIZE(size);
+
+        if ((Rbuf_MuxIsChannel(mux, channel) == false) || (record_size > used_size))
+        {
+          // Dropped bytes cannot be charged to a channel, release every quota
+          (void) RBUF_ReadCommit(ring, used_size);
+          for (uint8_t i = 0U; i < mux->channel_count; i++)
+          {
+            mux->channels[i].read = mux->channels[i].written;
+          }
+          more = false;
+        }
+        else
+        {
+          RBUF_MuxChannel_t *state = &mux->channels[channel];
+
+          if (state->handler != NULL)
+          {
+            RBUF_size_t start = (RBUF_size_t) (((uint32_t) ring->read_index + RBUF_MUX_HEADER_SIZE) % ring->size);
+            RBUF_size_t size1 = (RBUF_size_t) (ring->size - start);
+            RBUF_Span_t spans[2] = {{&ring->data[start], (RBUF_size_t) size}, {NULL, 0U}};
+
+            if (size > size1) // Rollover
+            {
+              spans[0].size = size1;
+              spans[1].data = &ring->data[0];
+              spans[1].size = (RBUF_size_t) (size - size1);
+            }
+            state->handler(channel, spans, state->context);
+          }
+          else
+          {
+            state->dropped++;
+          }
+          (void) RBUF_ReadCommit(ring, (RBUF_size_t) record_size);
+          state->read += record_size;
+          count++;
+        }
+      }
+    }
+  }
+  return count;
+}
+
+RBUF_size_t RBUF_MuxGetUsedSize(const RBUF_Mux_t *mux, uint8_t channel)
+{
+  RBUF_size_t used_size = 0U;
+
+  if (Rbuf_MuxIsChannel(mux, channel) == true)
+  {
+    used_size = (RBUF_size_t) (mux->channels[channel].written - mux->channels[channel].read);
+  }
+  return used_size;
+}
+
+// --- Private functions
+
+static bool Rbuf_MuxIsChannel(const RBUF_Mux_t *mux, uint8_t channel)
+{
+  return (mux != NULL) && (mux->channels != NULL) && (channel < mux->channel_count);
+}
+
+static bool Rbuf_MuxIsPayloadSize(RBUF_size_t size)
+{
+#ifdef RBUF_CFG_SIZE_32BIT
+  return (size <= RBUF_MUX_PAYLOAD_MAX);
+#else
+  (void) size; /* Any 16-bit size fits the header */
+  return true;
+#endif
+}
+
+/**
+ * \brief Get byte at offset from read index
+ * \param ring Ring to read
+ * \param offset Offset, lower than used size
+ * \return Byte
+ */
+static uint8_t Rbuf_MuxPeek(const RBUF_t *ring, uint32_t offset)
+{
+  return ring->data[((uint32_t) ring->read_index + offset) % ring->size];
+}
+
+/**
+ * \brief Copy bytes at offset from write index, not published
+ * \param ring Ring to write
+ * \param offset Offset past write index
+ * \param data Bytes to copy
+ * \param size Size to copy, offset + size lower than free size
+ */
+static void Rbuf_MuxPut(RBUF_t *ring, uint32_t offset, const uint8_t *data, uint32_t size)
+{
+  uint32_t start = ((uint32_t) ring->write_index + offset) % ring->size;
+  uint32_t size1 = ((start + size) > ring->size) ? (ring->size - start) : size;
+
+  if (size > 0U)
+  {
+    memcpy(&ring->data[start], data, size1);
+    memcpy(&ring->data[0], &data[size1], size - size1);
+  }
+}
@@ -0,0 +1,204 @@
+/**
+ * \file ring_buffer_pool.c
+ * \brief Ring Buffer storage pool carved out of a single arena
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Sizes are counted in quanta of the smallest block. The first
+ * RBUF_POOL_SUBCLASS_COUNT classes are 1 to RBUF_POOL_SUBCLASS_COUNT quanta,
+ * then each power of two is split in RBUF_POOL_SUBCLASS_COUNT steps. Class
+ * sizes are multiples of the quantum, and the arena start is aligned on it,
+ * so every bump keeps blocks aligned. Free blocks store the free list link
+ * in their first bytes.
+ */
+#include <string.h>
+
+#include "ring_buffer/ring_buffer_pool.h"
+
+// --- Private functions
+
+static bool Rbuf_PoolGetClass(const RBUF_Pool_t *pool, size_t size, size_t *class_index);
+static size_t Rbuf_PoolGetClassSize(const RBUF_Pool_t *pool, size_t class_index);
+
+// --- Public functions
+
+void RBUF_PoolInit(RBUF_Pool_t *pool, uint8_t *arena, size_t size, bool cache_line_pad)
+{
+  if (pool != NULL)
+  {
+    uint8_t min_shift = (cache_line_pad == true) ? 6U : RBUF_POOL_CLASS_MIN_SHIFT;
+    uintptr_t align = (uintptr_t) 1U << min_shift;
+    uintptr_t start = ((uintptr_t) arena + align - 1U) & ~(align - 1U);
+    size_t skip = (size_t) (start - (uintptr_t) arena);
+
+    memset(pool, 0, sizeof(*pool));
+    pool->min_shift = min_shift;
+    if ((arena != NULL) && (size > skip))
+    {
+      pool->arena = (uint8_t *) start;
+      pool->arena_size = size - skip;
+    }
+  }
+}
+
+uint8_t *RBUF_PoolAlloc(RBUF_Pool_t *pool, size_t size)
+{
+  uint8_t *block = NULL;
+  size_t class_index = 0U;
+
+  if ((pool != NULL) && (pool->arena != NULL) && (Rbuf_PoolGetClass(pool, size, &class_index) == true))
+  {
+    size_t class_size = Rbuf_PoolGetClassSize(pool, class_index);
+
+    if (pool->free_list[class_index] != NULL) // Reuse
+    {
+      block = (uint8_t *) pool->free_list[class_index];
+      memcpy(&pool->free_list[class_index], block, sizeof(void *));
+    }
+    else if ((pool->arena_size - pool->reserved_size) >= class_size) // Bump
+    {
+      block = &pool->arena[pool->reserved_size];
+      pool->reserved_size += class_size;
+    }
+    else
+    {
+      /* Arena exhausted */
+    }
+
+    if (block != NULL)
+    {
+      pool->used_size += class_size;
+      pool->requested_size += size;
+    }
+  }
+  return block;
+}
+
+void RBUF_PoolFree(RBUF_Pool_t *pool, uint8_t *block, size_t size)
+{
+  size_t class_index = 0U;
+
+  if ((pool != NULL) && (block != NULL) && (Rbuf_PoolGetClass(pool, size, &class_index) == true))
+  {
+    memcpy(block, &pool->free_list[class_index], sizeof(void *));
+    pool->free_list[class_index] = block;
+    pool->used_size -= Rbuf_PoolGetClassSize(pool, class_index);
+    pool->requested_size -= size;
+  }
+}
+
+bool RBUF_PoolCreate(RBUF_Pool_t *pool, RBUF_t *buffer, RBUF_size_t size)
+{
+  bool created = false;
+
+  if (buffer != NULL)
+  {
+    uint8_t *data = RBUF_PoolAlloc(pool, size);
+
+    if (data != NULL)
+    {
+      RBUF_InitEmpty(buffer, data, size);
+      created = true;
+    }
+  }
+  return created;
+}
+
+void RBUF_PoolDestroy(RBUF_Pool_t *pool, RBUF_t *buffer)
+{
+  if ((pool != NULL) && (buffer != NULL) && (buffer->data != NULL))
+  {
+    RBUF_PoolFree(pool, buffer->data, buffer->size);
+    RBUF_InitEmpty(buffer, NULL, 0U);
+  }
+}
+
+size_t RBUF_PoolGetUsedSize(const RBUF_Pool_t *pool)
+{
+  size_t used_size = 0U;
+
+  if (pool != NULL)
+  {
+    used_size = pool->used_size;
+  }
+  return used_size;
+}
+
+size_t RBUF_PoolGetWastedSize(const RBUF_Pool_t *pool)
+{
+  size_t wasted_size = 0U;
+
+  if (pool != NULL)
+  {
+    wasted_size = pool->used_size - pool->requested_size;
+  }
+  return wasted_size;
+}
+
+size_t RBUF_PoolGetReservedSize(const RBUF_Pool_t *pool)
+{
+  size_t reserved_size = 0U;
+
+  if (pool != NULL)
+  {
+    reserved_size = pool->reserved_size;
+  }
+  return reserved_size;
+}
+
+size_t RBUF_PoolGetFreeSize(const RBUF_Pool_t *pool)
+{
+  size_t free_size = 0U;
+
+  if (pool != NULL)
+  {
+    free_size = pool->arena_size - pool->reserved_size;
+  }
+  return free_size;
+}
+
+// --- Private functions
+
+/**
+ * \brief Get size class of a requested size
+ * \param pool Pool giving the smallest class
+ * \param size Requested size
+ * \param class_index Smallest class holding size
+ * \return true if size fits in a class, false otherwise
+ */
+static bool Rbuf_PoolGetClass(const RBUF_Pool_t *pool, size_t size, size_t *class_index)
+{
+  bool found = false;
+  size_t index = 0U;
+
+  if (size > 0U)
+  {
+    while ((index < RBUF_POOL_CLASS_COUNT) && (Rbuf_PoolGetClassSize(pool, index) < size))
+    {
+      index++;
+    }
+    found = (index < RBUF_POOL_CLASS_COUNT);
+    *class_index = index;
+  }
+  return found;
+}
+
+/**
+ * \brief Get block size of a class
+ * \param pool Pool giving the smallest class
+ * \param class_index Class
+ * \return Block size
+ */
+static size_t Rbuf_PoolGetClassSize(const RBUF_Pool_t *pool, size_t class_index)
+{
+  size_t quanta = class_index + 1U;
+
+  if (class_index >= RBUF_POOL_SUBCLASS_COUNT)
+  {
+    size_t group = (class_index / RBUF_POOL_SUBCLASS_COUNT) - 1U;
+    size_t step = (class_index % RBUF_POOL_SUBCLASS_COUNT) + 1U;
+
+    quanta = (RBUF_POOL_SUBCLASS_COUNT + step) << group;
+  }
+  return quanta << pool->min_shift;
+}
@@ -0,0 +1,372 @@
+/**
+ * \file ring_buffer_seg.c
+ * \brief Growable Ring Buffer made of pool segments, for host side buffering
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Segments form a FIFO list, read from head and written to tail. The tail
+ * segment is kept when the buffer drains, offsets restart at 0, so a
+ * steady low rate stream stays on one segment.
+ */
+#include <string.h>
+
+#include "ring_buffer/ring_buffer_seg.h"
+
+// --- Private functions
+
+static uint8_t *Rbuf_SegData(RBUF_Segment_t *segment);
+static RBUF_Segment_t *Rbuf_SegTake(RBUF_Seg_t *seg);
+static void Rbuf_SegGive(RBUF_Seg_t *seg, RBUF_Segment_t *segment);
+static bool Rbuf_SegReserve(RBUF_Seg_t *seg, RBUF_size_t size);
+static RBUF_size_t Rbuf_SegGetHeadSize(const RBUF_Seg_t *seg);
+static void Rbuf_SegRead(RBUF_Seg_t *seg, uint8_t *data, RBUF_size_t size);
+
+// --- Public functions
+
+void RBUF_SegInit(RBUF_Seg_t *seg, RBUF_Pool_t *pool, RBUF_size_t segment_size, uint16_t segment_max)
+{
+  if (seg != NULL)
+  {
+    seg->pool = pool;
+    seg->segment_size = segment_size;
+    seg->segment_max = segment_max;
+    seg->segment_count = 0U;
+    seg->head = NULL;
+    seg->tail = NULL;
+    seg->spare = NULL;
+    seg->read_offset = 0U;
+    seg->write_offset = 0U;
+    seg->used_size = 0U;
+  }
+}
+
+void RBUF_SegDestroy(RBUF_Seg_t *seg)
+{
+  if ((seg != NULL) && (seg->pool != NULL))
+  {
+    size_t block_size = sizeof(RBUF_Segment_t) + seg->segment_size;
+
+    while (seg->head != NULL)
+    {
+      RBUF_Segment_t *next = seg->head->next;
+
+      RBUF_PoolFree(seg->pool, (uint8_t *) seg->head, block_size);
+      seg->head = next;
+    }
+    if (seg->spare != NULL)
+    {
+      RBUF_PoolFree(seg->pool, (uint8_t *) seg->spare, block_size);
+    }
+    RBUF_SegInit(seg, seg->pool, seg->segment_size, seg->segment_max);
+  }
+}
+
+bool RBUF_SegIsEmpty(const RBUF_Seg_t *seg)
+{
+  return (RBUF_SegGetUsedSize(seg) == 0U);
+}
+
+size_t RBUF_SegGetUsedSize(const RBUF_Seg_t *seg)
+{
+  size_t used_size = 0U;
+
+  if (seg != NULL)
+  {
+    used_size = seg->used_size;
+  }
+  return used_size;
+}
+
+uint16_t RBUF_SegGetSegmentCount(const RBUF_Seg_t *seg)
+{
+  uint16_t count = 0U;
+
+  if (seg != NULL)
+  {
+    count = seg->segment_count;
+  }
+  return count;
+}
+
+bool RBUF_SegWriteUint8(RBUF_Seg_t *seg, uint8_t data)
+{
+  return RBUF_SegWriteString(seg, (const char *) &data, 1U);
+}
+
+bool RBUF_SegWriteString(RBUF_Seg_t *seg, const char *data, RBUF_size_t size)
+{
+  bool written = false;
+
+  if ((seg != NULL) && (data != NULL) && (Rbuf_SegReserve(seg, size) == true))
+  {
+    RBUF_size_t done = 0U;
+
+    while (done < size)
+    {
+      RBUF_size_t chunk;
+
+      if (seg->write_offset == seg->segment_size)
+      {
+        seg->tail = seg->tail->next; /* Linked by Rbuf_SegReserve */
+        seg->write_offset = 0U;
+      }
+      chunk = (RBUF_size_t) (seg->segment_size - seg->write_offset);
+      chunk = (chunk < (size - done)) ? chunk : (RBUF_size_t) (size - done);
+      memcpy(&Rbuf_SegData(seg->tail)[seg->write_offset], &data[done], chunk);
+      seg->write_offset += chunk;
+      done += chunk;
+    }
+    seg->used_size += size;
+    written = true;
+  }
+  return written;
+}
+
+uint8_t RBUF_SegReadUint8(RBUF_Seg_t *seg)
+{
+  uint8_t data = 0U;
+
+  if ((seg != NULL) && (seg->used_size > 0U))
+  {
+    Rbuf_SegRead(seg, &data, 1U);
+  }
+  return data;
+}
+
+bool RBUF_SegReadCopyBlock(BUF_t *buf_dst, RBUF_Seg_t *seg, RBUF_size_t size)
+{
+  bool read = false;
+
+  if ((buf_dst != NULL) && (buf_dst->data != NULL) && (seg != NULL) && (RBUF_SegGetUsedSize(seg) >= size)
+      && (BUF_GetFreeSize(buf_dst) >= size))
+  {
+    Rbuf_SegRead(seg, &buf_dst->data[buf_dst->write_index], size);
+    buf_dst->write_index += size;
+    read = true;
+  }
+  return read;
+}
+
+RBUF_size_t RBUF_SegReadCopyRaw(BUF_t *buf_dst, RBUF_Seg_t *seg, RBUF_size_t size)
+{
+  RBUF_size_t read = 0U;
+
+  if ((buf_dst != NULL) && (buf_dst->data != NULL) && (seg != NULL))
+  {
+    size_t to_read = seg->used_size;
+
+    to_read = (to_read < size) ? to_read : size;
+    to_read = (to_read < BUF_GetFreeSize(buf_dst)) ? to_read : BUF_GetFreeSize(buf_dst);
+    read = (RBUF_size_t) to_read;
+    Rbuf_SegRead(seg, &buf_dst->data[buf_dst->write_index], read);
+    buf_dst->write_index += read;
+  }
+  return read;
+}
+
+RBUF_size_t RBUF_SegPeek(const RBUF_Seg_t *seg, RBUF_Span_t spans[2])
+{
+  RBUF_size_t size = 0U;
+
+  if ((seg != NULL) && (spans != NULL))
+  {
+    spans[0].data = NULL;
+    spans[0].size = 0U;
+    spans[1].data = NULL;
+    spans[1].size = 0U;
+    if (seg->used_size > 0U)
+    {
+      spans[0].data = &Rbuf_SegData(seg->head)[seg->read_offset];
+      spans[0].size = Rbuf_SegGetHeadSize(seg);
+      if (seg->head != seg->tail)
+      {
+        RBUF_Segment_t *next = seg->head->next;
+
+        spans[1].data = Rbuf_SegData(next);
+        spans[1].size = (next == seg->tail) ? seg->write_offset : seg->segment_size;
+      }
+      size = (RBUF_size_t) (spans[0].size + spans[1].size);
+    }
+  }
+  return size;
+}
+
+bool RBUF_SegReadCommit(RBUF_Seg_t *seg, RBUF_size_t size)
+{
+  bool committed = false;
+
+  if ((seg != NULL) && (seg->used_size >= size))
+  {
+    Rbuf_SegRead(seg, NULL, size);
+    committed = true;
+  }
+  return committed;
+}
+
+// --- Private functions
+
+static uint8_t *Rbuf_SegData(RBUF_Segment_t *segment)
+{
+  return (uint8_t *) &segment[1];
+}
+
+/**
+ * \brief Get a segment from spare or pool
+ * \param seg Buffer growing
+ * \return Segment, NULL if at segment_max or pool exhausted
+ */
+static RBUF_Segment_t *Rbuf_SegTake(RBUF_Seg_t *seg)
+{
+  RBUF_Segment_t *segment = NULL;
+
+  if ((seg->segment_max == 0U) || (seg->segment_count < seg->segment_max))
+  {
+    segment = seg->spare;
+    if (segment != NULL)
+    {
+      seg->spare = NULL;
+    }
+    else
+    {
+      segment = (RBUF_Segment_t *) RBUF_PoolAlloc(seg->pool, sizeof(RBUF_Segment_t) + seg->segment_size);
+    }
+    if (segment != NULL)
+    {
+      segment->next = NULL;
+      seg->segment_count++;
+    }
+  }
+  return segment;
+}
+
+/**
+ * \brief Keep a drained segment as spare, or give it back to the pool
+ * \param seg Buffer shrinking
+ * \param segment Segment out of the list
+ */
+static void Rbuf_SegGive(RBUF_Seg_t *seg, RBUF_Segment_t *segment)
+{
+  seg->segment_count--;
+  if (seg->spare == NULL)
+  {
+    seg->spare = segment;
+  }
+  else
+  {
+    RBUF_PoolFree(seg->pool, (uint8_t *) segment, sizeof(RBUF_Segment_t) + seg->segment_size);
+  }
+}
+
+/**
+ * \brief Link the segments needed to write size bytes after tail
+ * \param seg Buffer to grow
+ * \param size Size about to be written
+ * \return true if room is available, false if segments are missing, none linked then
+ */
+static bool Rbuf_SegReserve(RBUF_Seg_t *seg, RBUF_size_t size)
+{
+  bool reserved = false;
+
+  if ((seg->pool != NULL) && (seg->segment_size > 0U))
+  {
+    size_t room = (seg->tail != NULL) ? (size_t) (seg->segment_size - seg->write_offset) : 0U;
+    RBUF_Segment_t *first = NULL;
+    RBUF_Segment_t *last = NULL;
+    bool missing = false;
+
+    while ((room < size) && (missing == false))
+    {
+      RBUF_Segment_t *segment = Rbuf_SegTake(seg);
+
+      missing = (segment == NULL);
+      if (missing == false)
+      {
+        if (last != NULL)
+        {
+          last->next = segment;
+        }
+        else
+        {
+          first = segment;
+        }
+        last = segment;
+        room += seg->segment_size;
+      }
+    }
+
+    if (missing == true)
+    {
+      while (first != NULL)
+      {
+        RBUF_Segment_t *next = first->next;
+
+        Rbuf_SegGive(seg, first);
+        first = next;
+      }
+    }
+    else if (first != NULL)
+    {
+      if (seg->tail == NULL)
+      {
+        seg->head = first;
+        seg->tail = first;
+      }
+      else
+      {
+        seg->tail->next = first; /* Tail moves on when the write reaches it */
+      }
+    }
+    reserved = (missing == false);
+  }
+  return reserved;
+}
+
+/**
+ * \brief Get readable bytes in head segment
+ * \param seg Non empty buffer
+ * \return Size from read_offset
+ */
+static RBUF_size_t Rbuf_SegGetHeadSize(const RBUF_Seg_t *seg)
+{
+  RBUF_size_t end = (seg->head == seg->tail) ? seg->write_offset : seg->segment_size;
+
+  return (RBUF_size_t) (end - seg->read_offset);
+}
+
+/**
+ * \brief Consume bytes, releasing drained segments
+ * \param seg Buffer holding at least size bytes
+ * \param data Destination, NULL to only release
+ * \param size Size to consume
+ */
+static void Rbuf_SegRead(RBUF_Seg_t *seg, uint8_t *data, RBUF_size_t size)
+{
+  RBUF_size_t done = 0U;
+
+  while (done < size)
+  {
+    RBUF_size_t chunk = Rbuf_SegGetHeadSize(seg);
+
+    chunk = (chunk < (size - done)) ? chunk : (RBUF_size_t) (size - done);
+    if (data != NULL)
+    {
+      memcpy(&data[done], &Rbuf_SegData(seg->head)[seg->read_offset], chunk);
+    }
+    seg->read_offset += chunk;
+    done += chunk;
+    if ((seg->read_offset == seg->segment_size) && (seg->head != seg->tail))
+    {
+      RBUF_Segment_t *drained = seg->head;
+
+      seg->head = drained->next;
+      seg->read_offset = 0U;
+      Rbuf_SegGive(seg, drained);
+    }
+  }
+  seg->used_size -= size;
+  if (seg->used_size == 0U)
+  {
+    seg->read_offset = 0U;
+    seg->write_offset = 0U;
+  }
+}
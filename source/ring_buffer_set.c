@@ -0,0 +1,173 @@
+/**
+ * \file ring_buffer_set.c
+ * \brief Set of Ring Buffers with readiness bitmap
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Members point to their bitmap word, bits are updated by the ring write and
+ * read functions. Lookups scan one bitmap word per 32 rings.
+ */
+#include <stdatomic.h>
+
+#include "ring_buffer/ring_buffer_set.h"
+
+// --- Private functions
+
+static uint32_t Rbuf_SetLoadWord(const RBUF_Set_t *set, uint16_t word);
+static uint16_t Rbuf_SetCtz(uint32_t value);
+static bool Rbuf_SetFindFrom(const RBUF_Set_t *set, uint16_t start, uint16_t *id);
+
+// --- Public functions
+
+void RBUF_SetInit(RBUF_Set_t *set, RBUF_t **rings, uint32_t *ready, uint16_t capacity)
+{
+  if ((set != NULL) && (rings != NULL) && (ready != NULL))
+  {
+    set->rings = rings;
+    set->ready = ready;
+    set->capacity = capacity;
+    set->cursor = 0U;
+    for (uint16_t id = 0U; id < capacity; id++)
+    {
+      rings[id] = NULL;
+    }
+    for (uint16_t word = 0U; word < RBUF_SET_WORDS(capacity); word++)
+    {
+      atomic_store_explicit((_Atomic uint32_t *) &ready[word], 0U, memory_order_relaxed);
+    }
+  }
+}
+
+bool RBUF_SetAdd(RBUF_Set_t *set, RBUF_t *buffer, uint16_t id)
+{
+  bool added = false;
+
+  if ((set != NULL) && (set->rings != NULL) && (buffer != NULL) && (id < set->capacity) && (set->rings[id] == NULL))
+  {
+    set->rings[id] = buffer;
+    buffer->ready_mask = 1UL << (id % 32U);
+    buffer->ready_word = &set->ready[id / 32U];
+    buffer->hooks |= RBUF_HOOK_READY;
+    if (RBUF_IsEmpty(buffer) == false)
+    {
+      (void) atomic_fetch_or_explicit((_Atomic uint32_t *) buffer->ready_word, buffer->ready_mask, memory_order_seq_cst);
+    }
+    added = true;
+  }
+  return added;
+}
+
+void RBUF_SetRemove(RBUF_Set_t *set, uint16_t id)
+{
+  RBUF_t *buffer = RBUF_SetGetRing(set, id);
+
+  if (buffer != NULL)
+  {
+    (void) atomic_fetch_and_explicit((_Atomic uint32_t *) buffer->ready_word, ~buffer->ready_mask, memory_order_seq_cst);
+    buffer->ready_word = NULL;
+    buffer->ready_mask = 0U;
+    buffer->hooks &= (uint8_t) ~RBUF_HOOK_READY;
+    set->rings[id] = NULL;
+  }
+}
+
+RBUF_t *RBUF_SetGetRing(const RBUF_Set_t *set, uint16_t id)
+{
+  RBUF_t *buffer = NULL;
+
+  if ((set != NULL) && (set->rings != NULL) && (id < set->capacity))
+  {
+    buffer = set->rings[id];
+  }
+  return buffer;
+}
+
+bool RBUF_SetNextReady(RBUF_Set_t *set, uint16_t *id)
+{
+  bool found = false;
+
+  if ((set != NULL) && (set->ready != NULL) && (id != NULL) && (set->capacity > 0U))
+  {
+    found = Rbuf_SetFindFrom(set, set->cursor, id);
+    if (found == false) // Wrap around
+    {
+      found = Rbuf_SetFindFrom(set, 0U, id);
+    }
+    if (found == true)
+    {
+      set->cursor = (uint16_t) ((*id + 1U) % set->capacity);
+    }
+  }
+  return found;
+}
+
+bool RBUF_SetFirstReady(const RBUF_Set_t *set, uint16_t *id)
+{
+  bool found = false;
+
+  if ((set != NULL) && (set->ready != NULL) && (id != NULL))
+  {
+    found = Rbuf_SetFindFrom(set, 0U, id);
+  }
+  return found;
+}
+
+// --- Private functions
+
+static uint32_t Rbuf_SetLoadWord(const RBUF_Set_t *set, uint16_t word)
+{
+  return atomic_load_explicit((_Atomic uint32_t *) &set->ready[word], memory_order_acquire);
+}
+
+/**
+ * \brief Count trailing zeros
+ * \param value Value to check, not 0
+ * \return Index of lowest set bit
+ */
+static uint16_t Rbuf_SetCtz(uint32_t value)
+{
+#if defined(__GNUC__)
+  return (uint16_t) __builtin_ctz(value);
+#else
+  uint16_t count = 0U;
+
+  while ((value & 1U) == 0U)
+  {
+    value >>= 1U;
+    count++;
+  }
+  return count;
+#endif
+}
+
+/**
+ * \brief Find lowest ready id at or after start
+ * \param set Set to check
+ * \param start First id to consider
+ * \param id Ready ring id
+ * \return true if found, false otherwise
+ */
+static bool Rbuf_SetFindFrom(const RBUF_Set_t *set, uint16_t start, uint16_t *id)
+{
+  bool found = false;
+  uint16_t word = start / 32U;
+  uint32_t bits = Rbuf_SetLoadWord(set, word) & (0xFFFFFFFFUL << (start % 32U));
+
+  while ((found == false) && (word < RBUF_SET_WORDS(set->capacity)))
+  {
+    if (bits != 0U)
+    {
+      *id = (uint16_t) ((word * 32U) + Rbuf_SetCtz(bits));
+      found = true;
+    }
+    else
+    {
+      word++;
+      if (word < RBUF_SET_WORDS(set->capacity))
+      {
+        bits = Rbuf_SetLoadWord(set, word);
+      }
+    }
+  }
+  return found;
+}
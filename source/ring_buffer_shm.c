@@ -0,0 +1,349 @@
+/**
+ * \file ring_buffer_shm.c
+ * \brief Ring Buffer shared between processes (shm_open/memfd_create) or persisted in a file
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Each process builds a local RBUF_t view (data pointer = base + data_offset)
+ * from the shared indices and reuses the regular ring functions on it.
+ * The producer only publishes write_index and the consumer only publishes
+ * read_index, with release/acquire ordering so data is visible before the
+ * index that covers it.
+ *
+ * File backed rings also keep a committed copy of both indices, advanced by
+ * RBUF_Sync. With RBUF_SYNC_SYNC the data it covers is on storage first.
+ * RBUF_SYNC_ASYNC commits the indices captured one call earlier, once their
+ * write back has been scheduled, so periodic asynchronous syncs keep the
+ * ring usable without waiting on storage. The producer measures free space from the committed read index, so committed
+ * bytes stay untouched until the next commit. Reopening restores the committed
+ * indices, so the ring comes back with a consistent prefix whatever order the
+ * kernel wrote dirty pages back in.
+ */
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "ring_buffer/ring_buffer_shm.h"
+
+// --- Private types
+
+#define RBUF_SHM_CACHE_LINE 64U
+
+/**
+ * \brief Shared region header, data follows at data_offset
+ * \details Indices sit on their own cache line to avoid false sharing between producer and consumer
+ */
+typedef struct Rbuf_ShmHeader_s
+{
+  _Atomic uint32_t magic; /*!< RBUF_SHM_MAGIC once the header is initialized */
+  uint32_t version;       /*!< RBUF_SHM_VERSION */
+  uint32_t data_offset;   /*!< Offset of data from the start of the region */
+  uint32_t size;          /*!< Ring size */
+  uint32_t persistent;    /*!< Non zero for file backed rings, free space bounded by commit_read_index */
+  _Alignas(RBUF_SHM_CACHE_LINE) _Atomic uint32_t write_index;
+  _Alignas(RBUF_SHM_CACHE_LINE) _Atomic uint32_t read_index;
+  _Alignas(RBUF_SHM_CACHE_LINE) _Atomic uint32_t commit_write_index; /*!< write_index as of last commit */
+  _Atomic uint32_t commit_read_index;                                /*!< read_index as of last commit */
+} Rbuf_ShmHeader_t;
+
+#define RBUF_SHM_DATA_OFFSET \
+  (((sizeof(Rbuf_ShmHeader_t) + RBUF_SHM_CACHE_LINE - 1U) / RBUF_SHM_CACHE_LINE) * RBUF_SHM_CACHE_LINE)
+
+// --- Private functions
+
+static bool Rbuf_ShmMap(RBUF_Shm_t *shm, int fd, size_t map_size);
+static bool Rbuf_ShmIsValid(const RBUF_Shm_t *shm);
+static void Rbuf_ShmLoadView(const RBUF_Shm_t *shm, RBUF_t *view);
+static void Rbuf_ShmLoadWriterView(const RBUF_Shm_t *shm, RBUF_t *view);
+static void Rbuf_ShmRestoreCommit(RBUF_Shm_t *shm);
+
+// --- Public functions
+
+size_t RBUF_ShmGetRegionSize(RBUF_size_t size)
+{
+  return RBUF_SHM_DATA_OFFSET + size;
+}
+
+bool RBUF_ShmCreate(RBUF_Shm_t *shm, int fd, RBUF_size_t size)
+{
+  bool created = false;
+  size_t map_size = RBUF_ShmGetRegionSize(size);
+
+  if ((shm != NULL) && (fd >= 0) && (size > 0U) && (ftruncate(fd, (off_t) map_size) == 0))
+  {
+    if (Rbuf_ShmMap(shm, fd, map_size) == true)
+    {
+      Rbuf_ShmHeader_t *header = (Rbuf_ShmHeader_t *) shm->base;
+
+      header->version = RBUF_SHM_VERSION;
+      header->data_offset = (uint32_t) RBUF_SHM_DATA_OFFSET;
+      header->size = size;
+      header->persistent = 0U;
+      atomic_store_explicit(&header->write_index, 0U, memory_order_relaxed);
+      atomic_store_explicit(&header->read_index, 0U, memory_order_relaxed);
+      atomic_store_explicit(&header->commit_write_index, 0U, memory_order_relaxed);
+      atomic_store_explicit(&header->commit_read_index, 0U, memory_order_relaxed);
+      /* Magic last: an attaching process never sees a partially initialized header */
+      atomic_store_explicit(&header->magic, RBUF_SHM_MAGIC, memory_order_release);
+      created = true;
+    }
+  }
+  return created;
+}
+
+bool RBUF_ShmAttach(RBUF_Shm_t *shm, int fd)
+{
+  bool attached = false;
+  struct stat st;
+
+  if ((shm != NULL) && (fd >= 0) && (fstat(fd, &st) == 0) && ((size_t) st.st_size >= RBUF_SHM_DATA_OFFSET))
+  {
+    if (Rbuf_ShmMap(shm, fd, (size_t) st.st_size) == true)
+    {
+      attached = Rbuf_ShmIsValid(shm);
+      if (attached == false)
+      {
+        RBUF_ShmDetach(shm);
+      }
+    }
+  }
+  return attached;
+}
+
+void RBUF_ShmDetach(RBUF_Shm_t *shm)
+{
+  if ((shm != NULL) && (shm->base != NULL))
+  {
+    (void) munmap(shm->base, shm->map_size);
+    shm->base = NULL;
+    shm->map_size = 0U;
+  }
+}
+
+bool RBUF_FileOpen(RBUF_Shm_t *shm, const char *path, RBUF_size_t size)
+{
+  bool opened = false;
+
+  if ((shm != NULL) && (path != NULL) && (size > 0U))
+  {
+    int fd = open(path, O_RDWR | O_CREAT | O_CLOEXEC, 0600);
+
+    if (fd >= 0)
+    {
+      if (RBUF_ShmAttach(shm, fd) == true)
+      {
+        if (((const Rbuf_ShmHeader_t *) shm->base)->size == size)
+        {
+          Rbuf_ShmRestoreCommit(shm);
+          opened = true;
+        }
+        else
+        {
+          RBUF_ShmDetach(shm);
+        }
+      }
+      if (opened == false)
+      {
+        opened = RBUF_ShmCreate(shm, fd, size);
+      }
+      if (opened == true)
+      {
+        ((Rbuf_ShmHeader_t *) shm->base)->persistent = 1U;
+      }
+      (void) close(fd); /* The mapping stays valid */
+    }
+  }
+  return opened;
+}
+
+bool RBUF_Sync(RBUF_Shm_t *shm, RBUF_SyncMode_t mode)
+{
+  bool synced = false;
+
+  if ((shm != NULL) && (shm->base != NULL))
+  {
+    Rbuf_ShmHeader_t *header = (Rbuf_ShmHeader_t *) shm->base;
+    uint32_t write_index = atomic_load_explicit(&header->write_index, memory_order_acquire);
+    uint32_t read_index = atomic_load_explicit(&header->read_index, memory_order_acquire);
+
+    if (mode == RBUF_SYNC_ASYNC)
+    {
+      /* Write back may complete in any order, only commit what an earlier call already scheduled */
+      if (shm->pending == true)
+      {
+        atomic_store_explicit(&header->commit_write_index, shm->pending_write_index, memory_order_relaxed);
+        atomic_store_explicit(&header->commit_read_index, shm->pending_read_index, memory_order_release);
+      }
+      synced = (msync(shm->base, shm->map_size, MS_ASYNC) == 0);
+      shm->pending_write_index = write_index;
+      shm->pending_read_index = read_index;
+      shm->pending = synced;
+    }
+    else
+    {
+      shm->pending = false;
+      synced = (mode == RBUF_SYNC_NONE) || (msync(shm->base, shm->map_size, MS_SYNC) == 0);
+      if (synced == true)
+      {
+        atomic_store_explicit(&header->commit_write_index, write_index, memory_order_relaxed);
+        atomic_store_explicit(&header->commit_read_index, read_index, memory_order_release);
+        if (mode == RBUF_SYNC_SYNC)
+        {
+          synced = (msync(shm->base, RBUF_SHM_DATA_OFFSET, MS_SYNC) == 0);
+        }
+      }
+    }
+  }
+  return synced;
+}
+
+RBUF_size_t RBUF_ShmGetUsedSize(const RBUF_Shm_t *shm)
+{
+  RBUF_size_t used_size = 0U;
+
+  if ((shm != NULL) && (shm->base != NULL))
+  {
+    RBUF_t view;
+    Rbuf_ShmLoadView(shm, &view);
+    used_size = RBUF_GetUsedSize(&view);
+  }
+  return used_size;
+}
+
+RBUF_size_t RBUF_ShmGetFreeSize(const RBUF_Shm_t *shm)
+{
+  RBUF_size_t free_size = 0U;
+
+  if ((shm != NULL) && (shm->base != NULL))
+  {
+    RBUF_t view;
+    Rbuf_ShmLoadWriterView(shm, &view);
+    free_size = RBUF_GetFreeSize(&view);
+  }
+  return free_size;
+}
+
+bool RBUF_ShmWriteString(RBUF_Shm_t *shm, const char *data, RBUF_size_t size)
+{
+  bool written = false;
+
+  if ((shm != NULL) && (shm->base != NULL))
+  {
+    Rbuf_ShmHeader_t *header = (Rbuf_ShmHeader_t *) shm->base;
+    RBUF_t view;
+
+    Rbuf_ShmLoadWriterView(shm, &view);
+    written = RBUF_WriteString(&view, data, size);
+    if (written == true)
+    {
+      atomic_store_explicit(&header->write_index, view.write_index, memory_order_release);
+    }
+  }
+  return written;
+}
+
+RBUF_size_t RBUF_ShmReadCopyRaw(BUF_t *buf_dst, RBUF_Shm_t *shm, RBUF_size_t size)
+{
+  RBUF_size_t read = 0U;
+
+  if ((shm != NULL) && (shm->base != NULL))
+  {
+    Rbuf_ShmHeader_t *header = (Rbuf_ShmHeader_t *) shm->base;
+    RBUF_t view;
+
+    Rbuf_ShmLoadView(shm, &view);
+    read = RBUF_ReadCopyRaw(buf_dst, &view, size);
+    if (read > 0U)
+    {
+      atomic_store_explicit(&header->read_index, view.read_index, memory_order_release);
+    }
+  }
+  return read;
+}
+
+// --- Private functions
+
+static bool Rbuf_ShmMap(RBUF_Shm_t *shm, int fd, size_t map_size)
+{
+  bool mapped = false;
+  void *base = mmap(NULL, map_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+  if (base != MAP_FAILED)
+  {
+    shm->base = base;
+    shm->map_size = map_size;
+    shm->pending = false;
+    mapped = true;
+  }
+  return mapped;
+}
+
+static bool Rbuf_ShmIsValid(const RBUF_Shm_t *shm)
+{
+  const Rbuf_ShmHeader_t *header = (const Rbuf_ShmHeader_t *) shm->base;
+  bool valid = false;
+
+  if (atomic_load_explicit(&header->magic, memory_order_acquire) == RBUF_SHM_MAGIC)
+  {
+    valid = (header->version == RBUF_SHM_VERSION) && (header->size > 0U)
+            && (header->size == (RBUF_size_t) header->size)
+            && (header->data_offset >= sizeof(Rbuf_ShmHeader_t))
+            && (((size_t) header->data_offset + header->size) <= shm->map_size);
+  }
+  return valid;
+}
+
+/**
+ * \brief Restore live indices from the committed ones after reopening a file
+ * \param shm Shared ring handle
+ * \details Out of range committed indices (corrupted header) reset the ring to empty
+ */
+static void Rbuf_ShmRestoreCommit(RBUF_Shm_t *shm)
+{
+  Rbuf_ShmHeader_t *header = (Rbuf_ShmHeader_t *) shm->base;
+  uint32_t write_index = atomic_load_explicit(&header->commit_write_index, memory_order_relaxed);
+  uint32_t read_index = atomic_load_explicit(&header->commit_read_index, memory_order_relaxed);
+
+  if ((write_index >= header->size) || (read_index >= header->size))
+  {
+    write_index = 0U;
+    read_index = 0U;
+    atomic_store_explicit(&header->commit_write_index, 0U, memory_order_relaxed);
+    atomic_store_explicit(&header->commit_read_index, 0U, memory_order_relaxed);
+  }
+  atomic_store_explicit(&header->write_index, write_index, memory_order_relaxed);
+  atomic_store_explicit(&header->read_index, read_index, memory_order_release);
+}
+
+/**
+ * \brief Build a process local view of the shared ring
+ * \param shm Shared ring handle
+ * \param view Ring view to fill, data points into this process mapping
+ */
+static void Rbuf_ShmLoadView(const RBUF_Shm_t *shm, RBUF_t *view)
+{
+  Rbuf_ShmHeader_t *header = (Rbuf_ShmHeader_t *) shm->base;
+
+  RBUF_InitEmpty(view, (uint8_t *) shm->base + header->data_offset, (RBUF_size_t) header->size);
+  view->write_index = (RBUF_size_t) atomic_load_explicit(&header->write_index, memory_order_acquire);
+  view->read_index = (RBUF_size_t) atomic_load_explicit(&header->read_index, memory_order_acquire);
+}
+
+/**
+ * \brief Build a process local view of the shared ring for the producer
+ * \param shm Shared ring handle
+ * \param view Ring view to fill, read index is the committed one for file backed rings
+ */
+static void Rbuf_ShmLoadWriterView(const RBUF_Shm_t *shm, RBUF_t *view)
+{
+  Rbuf_ShmHeader_t *header = (Rbuf_ShmHeader_t *) shm->base;
+
+  Rbuf_ShmLoadView(shm, view);
+  if (header->persistent != 0U)
+  {
+    view->read_index = (RBUF_size_t) atomic_load_explicit(&header->commit_read_index, memory_order_acquire);
+  }
+}
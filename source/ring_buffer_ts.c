@@ -0,0 +1,180 @@
+/**
+ * \file ring_buffer_ts.c
+ * \brief Timestamped fixed size record Ring Buffer with time window queries
+ * \date 2026-10
+ * \author Nicolas Boutin
+ */
+#include <string.h>
+
+#include "ring_buffer/ring_buffer_ts.h"
+
+// --- Private functions
+
+static RBUF_size_t Rbuf_TsLowerBound(const RBUF_Ts_t *ts, uint32_t timestamp, bool upper);
+static int32_t Rbuf_TsCompare(uint32_t a, uint32_t b);
+
+// --- Public functions
+
+void RBUF_TsInit(RBUF_Ts_t *ts, uint8_t *data, RBUF_size_t size, RBUF_size_t payload_size)
+{
+  if (ts != NULL)
+  {
+    uint32_t record_size = RBUF_TS_RECORD_SIZE((uint32_t) payload_size); /* No RBUF_size_t overflow */
+
+    ts->data = data;
+    ts->record_size = (record_size <= size) ? (RBUF_size_t) record_size : 0U;
+    ts->capacity = ((data != NULL) && (ts->record_size > 0U)) ? (RBUF_size_t) (size / ts->record_size) : 0U;
+    ts->head = 0U;
+    ts->count = 0U;
+  }
+}
+
+RBUF_size_t RBUF_TsGetCount(const RBUF_Ts_t *ts)
+{
+  RBUF_size_t count = 0U;
+
+  if (ts != NULL)
+  {
+    count = ts->count;
+  }
+  return count;
+}
+
+bool RBUF_TsPush(RBUF_Ts_t *ts, uint32_t timestamp, const uint8_t *payload)
+{
+  bool pushed = false;
+
+  if ((ts != NULL) && (ts->capacity > 0U) && (payload != NULL))
+  {
+    uint8_t *newest = RBUF_TsGetRecord(ts, ts->count - 1U);
+
+    if ((newest == NULL) || (Rbuf_TsCompare(timestamp, RBUF_TsGetTimestamp(newest)) >= 0))
+    {
+      if (ts->count == ts->capacity) // Overwrite oldest
+      {
+        (void) RBUF_TsPop(ts);
+      }
+      uint8_t *record = &ts->data[((ts->head + ts->count) % ts->capacity) * ts->record_size];
+      memcpy(record, &timestamp, RBUF_TS_TIMESTAMP_SIZE);
+      memcpy(&record[RBUF_TS_TIMESTAMP_SIZE], payload, ts->record_size - RBUF_TS_TIMESTAMP_SIZE);
+      ts->count++;
+      pushed = true;
+    }
+  }
+  return pushed;
+}
+
+bool RBUF_TsPop(RBUF_Ts_t *ts)
+{
+  bool popped = false;
+
+  if ((ts != NULL) && (ts->count > 0U))
+  {
+    ts->head = (RBUF_size_t) ((ts->head + 1U) % ts->capacity);
+    ts->count--;
+    popped = true;
+  }
+  return popped;
+}
+
+uint8_t *RBUF_TsGetRecord(const RBUF_Ts_t *ts, RBUF_size_t index)
+{
+  uint8_t *record = NULL;
+
+  if ((ts != NULL) && (index < ts->count))
+  {
+    record = &ts->data[((ts->head + index) % ts->capacity) * ts->record_size];
+  }
+  return record;
+}
+
+uint32_t RBUF_TsGetTimestamp(const uint8_t *record)
+{
+  uint32_t timestamp = 0U;
+
+  if (record != NULL)
+  {
+    memcpy(&timestamp, record, RBUF_TS_TIMESTAMP_SIZE);
+  }
+  return timestamp;
+}
+
+RBUF_size_t RBUF_TsQuery(const RBUF_Ts_t *ts, uint32_t t0, uint32_t t1, RBUF_Span_t spans[2])
+{
+  RBUF_size_t count = 0U;
+
+  if ((ts != NULL) && (spans != NULL))
+  {
+    spans[0].data = NULL;
+    spans[0].size = 0U;
+    spans[1].data = NULL;
+    spans[1].size = 0U;
+
+    if (Rbuf_TsCompare(t1, t0) >= 0)
+    {
+      RBUF_size_t first = Rbuf_TsLowerBound(ts, t0, false);
+      RBUF_size_t last = Rbuf_TsLowerBound(ts, t1, true);
+
+      if (last > first)
+      {
+        RBUF_size_t start = (RBUF_size_t) ((ts->head + first) % ts->capacity);
+        RBUF_size_t count1 = (RBUF_size_t) (last - first);
+
+        count = count1;
+        if ((start + count1) > ts->capacity) // Rollover
+        {
+          count1 = (RBUF_size_t) (ts->capacity - start);
+          spans[1].data = &ts->data[0];
+          spans[1].size = (RBUF_size_t) ((count - count1) * ts->record_size);
+        }
+        spans[0].data = &ts->data[start * ts->record_size];
+        spans[0].size = (RBUF_size_t) (count1 * ts->record_size);
+      }
+    }
+  }
+  return count;
+}
+
+// --- Private functions
+
+/**
+ * \brief Binary search over logical order
+ * \param ts Record buffer to search
+ * \param timestamp Timestamp to search
+ * \param upper false for first record >= timestamp, true for first record > timestamp
+ * \return Logical index, count if none
+ */
+static RBUF_size_t Rbuf_TsLowerBound(const RBUF_Ts_t *ts, uint32_t timestamp, bool upper)
+{
+  RBUF_size_t low = 0U;
+  RBUF_size_t high = ts->count;
+
+  while (low < high)
+  {
+    RBUF_size_t middle = (RBUF_size_t) (low + ((high - low) / 2U));
+    uint32_t middle_timestamp = RBUF_TsGetTimestamp(RBUF_TsGetRecord(ts, middle));
+    int32_t order = Rbuf_TsCompare(middle_timestamp, timestamp);
+    bool before = (upper == true) ? (order <= 0) : (order < 0);
+
+    if (before == true)
+    {
+      low = (RBUF_size_t) (middle + 1U);
+    }
+    else
+    {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+/**
+ * \brief Compare wrapping timestamps
+ * \param a First timestamp
+ * \param b Second timestamp
+ * \return Negative if a is before b, 0 if equal, positive if after, valid within 2^31 ticks
+ */
+static int32_t Rbuf_TsCompare(uint32_t a, uint32_t b)
+{
+  return (int32_t) (a - b);
+}
@@ -0,0 +1,357 @@
+/**
+ * \file ring_buffer_uring.c
+ * \brief Ring Buffer filling and draining with io_uring, Linux hosts
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * io_uring_setup, io_uring_enter and io_uring_register are called through
+ * syscall, no liburing dependency. Submission tail and completion head are
+ * published with release stores, kernel owned indices are read with acquire
+ * loads. Completion user data is the stream address.
+ */
+#define _GNU_SOURCE
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "ring_buffer/ring_buffer_uring.h"
+
+// --- Private functions
+
+static bool Rbuf_UringMap(RBUF_Uring_t *uring, const struct io_uring_params *params);
+static void Rbuf_UringRelease(RBUF_Uring_t *uring);
+static bool Rbuf_UringIsReady(const RBUF_Uring_t *uring);
+static void Rbuf_UringPrepare(const RBUF_UringStream_t *stream, struct io_uring_sqe *sqe, uint32_t iov_count);
+static int Rbuf_UringEnter(RBUF_Uring_t *uring, uint32_t wait_count);
+static int Rbuf_UringReap(RBUF_Uring_t *uring);
+static void Rbuf_UringComplete(RBUF_UringStream_t *stream, int32_t result);
+
+// --- Public functions
+
+bool RBUF_UringInit(RBUF_Uring_t *uring, uint32_t entries)
+{
+  bool created = false;
+
+  if ((uring != NULL) && (entries > 0U))
+  {
+    struct io_uring_params params;
+
+    memset(uring, 0, sizeof(*uring));
+    memset(&params, 0, sizeof(params));
+    uring->fd = (int) syscall(__NR_io_uring_setup, entries, &params);
+    if (uring->fd >= 0)
+    {
+      created = Rbuf_UringMap(uring, &params);
+    }
+    if (created == false)
+    {
+      Rbuf_UringRelease(uring);
+    }
+  }
+  return created;
+}
+
+void RBUF_UringDestroy(RBUF_Uring_t *uring)
+{
+  if (Rbuf_UringIsReady(uring) == true)
+  {
+    Rbuf_UringRelease(uring);
+  }
+}
+
+void RBUF_UringStreamInit(RBUF_UringStream_t *stream, RBUF_t *ring, int fd, RBUF_UringDir_t direction,
+                          uint64_t offset)
+{
+  if (stream != NULL)
+  {
+    memset(stream, 0, sizeof(*stream));
+    stream->ring = ring;
+    stream->fd = fd;
+    stream->direction = direction;
+    stream->offset = offset;
+    stream->buffer_index = RBUF_URING_BUFFER_NONE;
+  }
+}
+
+bool RBUF_UringRegister(RBUF_Uring_t *uring, RBUF_UringStream_t *const *streams, uint16_t count)
+{
+  bool registered = false;
+
+  if ((Rbuf_UringIsReady(uring) == true) && (uring->registered == false) && (streams != NULL) && (count > 0U)
+      && (count <= RBUF_URING_BUFFER_MAX))
+  {
+    struct iovec iov[RBUF_URING_BUFFER_MAX];
+    bool valid = true;
+
+    for (uint16_t i = 0U; (i < count) && (valid == true); i++)
+    {
+      valid = (streams[i] != NULL) && (streams[i]->ring != NULL) && (streams[i]->ring->data != NULL);
+      if (valid == true)
+      {
+        iov[i].iov_base = streams[i]->ring->data;
+        iov[i].iov_len = streams[i]->ring->size;
+      }
+    }
+    if ((valid == true)
+        && (syscall(__NR_io_uring_register, uring->fd, IORING_REGISTER_BUFFERS, iov, (unsigned int) count) == 0))
+    {
+      for (uint16_t i = 0U; i < count; i++)
+      {
+        streams[i]->buffer_index = (int) i;
+      }
+      uring->registered = true;
+      registered = true;
+    }
+  }
+  return registered;
+}
+
+bool RBUF_UringQueue(RBUF_Uring_t *uring, RBUF_UringStream_t *stream)
+{
+  bool queued = false;
+
+  if ((Rbuf_UringIsReady(uring) == true) && (stream != NULL) && (stream->busy == false) && (stream->eof == false))
+  {
+    RBUF_Span_t spans[2];
+    RBUF_size_t size = (stream->direction == RBUF_URING_FILL) ? RBUF_WriteReserve(stream->ring, spans)
+                                                              : RBUF_ReadPeek(stream->ring, spans);
+    uint32_t tail = *uring->sq_tail;
+    uint32_t head = atomic_load_explicit((_Atomic uint32_t *) uring->sq_head, memory_order_acquire);
+
+    if ((size > 0U) && ((tail - head) <= uring->sq_mask))
+    {
+      uint32_t index = tail & uring->sq_mask;
+      uint32_t iov_count = (spans[1].size > 0U) ? 2U : 1U;
+
+      for (uint32_t i = 0U; i < 2U; i++)
+      {
+        stream->iov[i].iov_base = spans[i].data;
+        stream->iov[i].iov_len = spans[i].size;
+      }
+      Rbuf_UringPrepare(stream, &uring->sqes[index], iov_count);
+      uring->sq_array[index] = index;
+      atomic_store_explicit((_Atomic uint32_t *) uring->sq_tail, tail + 1U, memory_order_release);
+      uring->queued++;
+      stream->busy = true;
+      queued = true;
+    }
+  }
+  return queued;
+}
+
+int RBUF_UringSubmit(RBUF_Uring_t *uring, uint32_t wait_count)
+{
+  int completed = -EINVAL;
+
+  if (Rbuf_UringIsReady(uring) == true)
+  {
+    completed = 0;
+    if ((uring->queued > 0U) || (wait_count > 0U))
+    {
+      completed = Rbuf_UringEnter(uring, wait_count);
+    }
+    if (completed >= 0)
+    {
+      completed = Rbuf_UringReap(uring);
+    }
+  }
+  return completed;
+}
+
+// --- Private functions
+
+/**
+ * \brief Map submission ring, completion ring and submission entries
+ * \param uring Instance with fd set
+ * \param params Setup result
+ * \return true if mapped, false otherwise
+ */
+static bool Rbuf_UringMap(RBUF_Uring_t *uring, const struct io_uring_params *params)
+{
+  bool mapped = false;
+  void *sq_map = NULL;
+  void *cq_map = NULL;
+  void *sqes = NULL;
+
+  uring->sq_map_size = params->sq_off.array + (params->sq_entries * sizeof(uint32_t));
+  uring->cq_map_size = params->cq_off.cqes + (params->cq_entries * sizeof(struct io_uring_cqe));
+  uring->sqes_size = params->sq_entries * sizeof(struct io_uring_sqe);
+
+  sq_map = mmap(NULL, uring->sq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring->fd,
+                IORING_OFF_SQ_RING);
+  cq_map = mmap(NULL, uring->cq_map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring->fd,
+                IORING_OFF_CQ_RING);
+  sqes = mmap(NULL, uring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, uring->fd, IORING_OFF_SQES);
+  uring->sq_map = (sq_map != MAP_FAILED) ? sq_map : NULL;
+  uring->cq_map = (cq_map != MAP_FAILED) ? cq_map : NULL;
+  uring->sqes = (sqes != MAP_FAILED) ? sqes : NULL;
+
+  if ((uring->sq_map != NULL) && (uring->cq_map != NULL) && (uring->sqes != NULL))
+  {
+    uint8_t *sq = uring->sq_map;
+    uint8_t *cq = uring->cq_map;
+
+    uring->sq_head = (uint32_t *) &sq[params->sq_off.head];
+    uring->sq_tail = (uint32_t *) &sq[params->sq_off.tail];
+    uring->sq_array = (uint32_t *) &sq[params->sq_off.array];
+    uring->sq_mask = *(uint32_t *) &sq[params->sq_off.ring_mask];
+    uring->cq_head = (uint32_t *) &cq[params->cq_off.head];
+    uring->cq_tail = (uint32_t *) &cq[params->cq_off.tail];
+    uring->cqes = (struct io_uring_cqe *) &cq[params->cq_off.cqes];
+    uring->cq_mask = *(uint32_t *) &cq[params->cq_off.ring_mask];
+    mapped = true;
+  }
+  return mapped;
+}
+
+/**
+ * \brief Unmap rings and close instance, whatever was set up
+ * \param uring Instance
+ */
+static void Rbuf_UringRelease(RBUF_Uring_t *uring)
+{
+  if (uring->sqes != NULL)
+  {
+    (void) munmap(uring->sqes, uring->sqes_size);
+  }
+  if (uring->cq_map != NULL)
+  {
+    (void) munmap(uring->cq_map, uring->cq_map_size);
+  }
+  if (uring->sq_map != NULL)
+  {
+    (void) munmap(uring->sq_map, uring->sq_map_size);
+  }
+  if (uring->fd >= 0)
+  {
+    (void) close(uring->fd);
+  }
+  memset(uring, 0, sizeof(*uring));
+  uring->fd = -1;
+}
+
+static bool Rbuf_UringIsReady(const RBUF_Uring_t *uring)
+{
+  return (uring != NULL) && (uring->sqes != NULL); /* Left NULL unless init succeeded */
+}
+
+/**
+ * \brief Fill submission entry for the stream spans
+ * \param stream Stream with iov set
+ * \param sqe Entry to fill
+ * \param iov_count Spans in use
+ */
+static void Rbuf_UringPrepare(const RBUF_UringStream_t *stream, struct io_uring_sqe *sqe, uint32_t iov_count)
+{
+  bool fill = (stream->direction == RBUF_URING_FILL);
+
+  memset(sqe, 0, sizeof(*sqe));
+  sqe->fd = stream->fd;
+  sqe->off = stream->offset; /* UINT64_MAX is -1, the file position */
+  sqe->user_data = (uint64_t) (uintptr_t) stream;
+  if (stream->buffer_index != RBUF_URING_BUFFER_NONE) /* Fixed buffer, first span only */
+  {
+    sqe->opcode = fill ? IORING_OP_READ_FIXED : IORING_OP_WRITE_FIXED;
+    sqe->addr = (uint64_t) (uintptr_t) stream->iov[0].iov_base;
+    sqe->len = (uint32_t) stream->iov[0].iov_len;
+    sqe->buf_index = (uint16_t) stream->buffer_index;
+  }
+  else
+  {
+    sqe->opcode = fill ? IORING_OP_READV : IORING_OP_WRITEV;
+    sqe->addr = (uint64_t) (uintptr_t) stream->iov;
+    sqe->len = iov_count;
+  }
+}
+
+/**
+ * \brief Submit queued entries, retried on signal interruption
+ * \param uring Instance
+ * \param wait_count Completions to wait for
+ * \return 0 on success, negative errno otherwise
+ */
+static int Rbuf_UringEnter(RBUF_Uring_t *uring, uint32_t wait_count)
+{
+  int status = 0;
+  long submitted = -1;
+  uint32_t flags = (wait_count > 0U) ? IORING_ENTER_GETEVENTS : 0U;
+
+  wait_count = (wait_count < (uring->in_flight + uring->queued)) ? wait_count : (uring->in_flight + uring->queued);
+  do
+  {
+    submitted = syscall(__NR_io_uring_enter, uring->fd, uring->queued, wait_count, flags, NULL, 0);
+  } while ((submitted < 0) && (errno == EINTR));
+
+  if (submitted >= 0)
+  {
+    uring->queued -= (uint32_t) submitted;
+    uring->in_flight += (uint32_t) submitted;
+  }
+  else
+  {
+    status = -errno;
+  }
+  return status;
+}
+
+/**
+ * \brief Process available completions
+ * \param uring Instance
+ * \return Completions processed
+ */
+static int Rbuf_UringReap(RBUF_Uring_t *uring)
+{
+  int completed = 0;
+  uint32_t head = *uring->cq_head;
+  uint32_t tail = atomic_load_explicit((_Atomic uint32_t *) uring->cq_tail, memory_order_acquire);
+
+  while (head != tail)
+  {
+    const struct io_uring_cqe *cqe = &uring->cqes[head & uring->cq_mask];
+
+    Rbuf_UringComplete((RBUF_UringStream_t *) (uintptr_t) cqe->user_data, cqe->res);
+    head++;
+    completed++;
+  }
+  atomic_store_explicit((_Atomic uint32_t *) uring->cq_head, head, memory_order_release);
+  uring->in_flight -= (uint32_t) completed;
+  return completed;
+}
+
+/**
+ * \brief Commit completed transfer to the stream ring
+ * \param stream Stream of the completed operation
+ * \param result Transferred size, or negative errno
+ */
+static void Rbuf_UringComplete(RBUF_UringStream_t *stream, int32_t result)
+{
+  stream->busy = false;
+  if (result > 0)
+  {
+    if (stream->direction == RBUF_URING_FILL)
+    {
+      (void) RBUF_WriteCommit(stream->ring, (RBUF_size_t) result);
+    }
+    else
+    {
+      (void) RBUF_ReadCommit(stream->ring, (RBUF_size_t) result);
+    }
+    if (stream->offset != RBUF_URING_OFFSET_NONE)
+    {
+      stream->offset += (uint64_t) result;
+    }
+    stream->bytes += (uint64_t) result;
+  }
+  else if (result == 0)
+  {
+    stream->eof = (stream->direction == RBUF_URING_FILL);
+  }
+  else
+  {
+    stream->error = result;
+  }
+}
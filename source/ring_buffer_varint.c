@@ -0,0 +1,130 @@
+/**
+ * \file ring_buffer_varint.c
+ * \brief LEB128 variable length integers in a Ring Buffer
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Encoded bytes go straight to buffer data across rollover after a single
+ * free space check, then the whole value is committed at once.
+ */
+#include "ring_buffer/ring_buffer_varint.h"
+
+// --- Private constants
+
+#define RBUF_VARINT_CONTINUE 0x80U
+#define RBUF_VARINT_PAYLOAD  0x7FU
+
+// --- Public functions
+
+uint8_t RBUF_VarintGetSize(uint32_t value)
+{
+  uint8_t size = 1U;
+
+  while (value > RBUF_VARINT_PAYLOAD)
+  {
+    value >>= 7U;
+    size++;
+  }
+  return size;
+}
+
+bool RBUF_WriteVarint(RBUF_t *buffer, uint32_t value)
+{
+  bool written = false;
+  uint8_t size = RBUF_VarintGetSize(value);
+
+  if ((buffer != NULL) && (buffer->data != NULL) && (RBUF_GetFreeSize(buffer) >= size))
+  {
+    RBUF_size_t index = buffer->write_index;
+
+    for (uint8_t i = 0U; i < size; i++)
+    {
+      uint8_t group = (uint8_t) (value & RBUF_VARINT_PAYLOAD);
+
+      value >>= 7U;
+      buffer->data[index] = (i < (size - 1U)) ? (uint8_t) (group | RBUF_VARINT_CONTINUE) : group;
+      index = (RBUF_size_t) ((index + 1U) % buffer->size);
+    }
+    written = RBUF_WriteCommit(buffer, size);
+  }
+  return written;
+}
+
+bool RBUF_WriteVarintSigned(RBUF_t *buffer, int32_t value)
+{
+  uint32_t zigzag = ((uint32_t) value << 1U) ^ (uint32_t) (value >> 31U);
+  return RBUF_WriteVarint(buffer, zigzag);
+}
+
+RBUF_VarintStatus_t RBUF_PeekVarint(const RBUF_t *buffer, uint32_t *value, uint8_t *size)
+{
+  RBUF_VarintStatus_t status = RBUF_VARINT_INVALID;
+
+  if ((buffer != NULL) && (buffer->data != NULL) && (value != NULL))
+  {
+    RBUF_size_t used = RBUF_GetUsedSize(buffer);
+    RBUF_size_t index = buffer->read_index;
+    uint32_t decoded = 0U;
+    uint8_t count = 0U;
+
+    status = RBUF_VARINT_INCOMPLETE;
+    while ((status == RBUF_VARINT_INCOMPLETE) && (count < used))
+    {
+      uint8_t byte = buffer->data[index];
+
+      if ((count == (RBUF_VARINT_SIZE_MAX - 1U)) && (byte > 0x0FU)) // Fifth byte holds 4 bits
+      {
+        status = RBUF_VARINT_INVALID;
+        count++;
+      }
+      else
+      {
+        decoded |= (uint32_t) (byte & RBUF_VARINT_PAYLOAD) << (7U * count);
+        count++;
+        index = (RBUF_size_t) ((index + 1U) % buffer->size);
+        if ((byte & RBUF_VARINT_CONTINUE) == 0U)
+        {
+          status = RBUF_VARINT_OK;
+        }
+      }
+    }
+
+    if (status == RBUF_VARINT_OK)
+    {
+      *value = decoded;
+    }
+    if ((status != RBUF_VARINT_INCOMPLETE) && (size != NULL))
+    {
+      *size = count;
+    }
+  }
+  return status;
+}
+
+RBUF_VarintStatus_t RBUF_ReadVarint(RBUF_t *buffer, uint32_t *value)
+{
+  uint8_t size = 0U;
+  RBUF_VarintStatus_t status = RBUF_PeekVarint(buffer, value, &size);
+
+  if (size > 0U) // Decoded value or malformed bytes
+  {
+    (void) RBUF_ReadCommit(buffer, size);
+  }
+  return status;
+}
+
+RBUF_VarintStatus_t RBUF_ReadVarintSigned(RBUF_t *buffer, int32_t *value)
+{
+  uint32_t zigzag = 0U;
+  RBUF_VarintStatus_t status = RBUF_VARINT_INVALID;
+
+  if (value != NULL)
+  {
+    status = RBUF_ReadVarint(buffer, &zigzag);
+    if (status == RBUF_VARINT_OK)
+    {
+      *value = (int32_t) ((zigzag >> 1U) ^ (~(zigzag & 1U) + 1U));
+    }
+  }
+  return status;
+}
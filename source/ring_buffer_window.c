@@ -0,0 +1,187 @@
+/**
+ * \file ring_buffer_window.c
+ * \brief Sliding window of samples with incremental sum, min, max and mean
+ * \date 2026-10
+ * \author Nicolas Boutin
+ * \details
+ * Deques hold sample slots. A slot is reused only once its sample is
+ * evicted, so eviction pops a deque front when it holds the evicted slot.
+ */
+#include "ring_buffer/ring_buffer_window.h"
+
+// --- Private functions
+
+static void Rbuf_DequeInit(RBUF_WindowDeque_t *deque, RBUF_size_t *slots);
+static RBUF_size_t Rbuf_DequeBack(const RBUF_Window_t *window, const RBUF_WindowDeque_t *deque);
+static void Rbuf_DequePush(const RBUF_Window_t *window, RBUF_WindowDeque_t *deque, RBUF_size_t slot, bool is_max);
+static void Rbuf_DequeEvict(const RBUF_Window_t *window, RBUF_WindowDeque_t *deque, RBUF_size_t slot);
+
+// --- Public functions
+
+void RBUF_WindowInit(RBUF_Window_t *window, int32_t *samples, RBUF_size_t *min_slots, RBUF_size_t *max_slots,
+                     RBUF_size_t capacity)
+{
+  if (window != NULL)
+  {
+    bool valid = (samples != NULL) && (min_slots != NULL) && (max_slots != NULL);
+
+    window->samples = samples;
+    window->capacity = (valid == true) ? capacity : 0U;
+    window->head = 0U;
+    window->count = 0U;
+    window->sum = 0;
+    Rbuf_DequeInit(&window->min, min_slots);
+    Rbuf_DequeInit(&window->max, max_slots);
+  }
+}
+
+bool RBUF_WindowPush(RBUF_Window_t *window, int32_t sample)
+{
+  bool pushed = false;
+
+  if ((window != NULL) && (window->capacity > 0U))
+  {
+    if (window->count == window->capacity)
+    {
+      (void) RBUF_WindowPop(window);
+    }
+    RBUF_size_t slot = (RBUF_size_t) ((window->head + window->count) % window->capacity);
+
+    window->samples[slot] = sample;
+    window->count++;
+    window->sum += sample;
+    Rbuf_DequePush(window, &window->min, slot, false);
+    Rbuf_DequePush(window, &window->max, slot, true);
+    pushed = true;
+  }
+  return pushed;
+}
+
+bool RBUF_WindowPop(RBUF_Window_t *window)
+{
+  bool popped = false;
+
+  if ((window != NULL) && (window->count > 0U))
+  {
+    window->sum -= window->samples[window->head];
+    Rbuf_DequeEvict(window, &window->min, window->head);
+    Rbuf_DequeEvict(window, &window->max, window->head);
+    window->head = (RBUF_size_t) ((window->head + 1U) % window->capacity);
+    window->count--;
+    popped = true;
+  }
+  return popped;
+}
+
+RBUF_size_t RBUF_WindowGetCount(const RBUF_Window_t *window)
+{
+  RBUF_size_t count = 0U;
+
+  if (window != NULL)
+  {
+    count = window->count;
+  }
+  return count;
+}
+
+int64_t RBUF_WindowGetSum(const RBUF_Window_t *window)
+{
+  int64_t sum = 0;
+
+  if (window != NULL)
+  {
+    sum = window->sum;
+  }
+  return sum;
+}
+
+bool RBUF_WindowGetMin(const RBUF_Window_t *window, int32_t *min)
+{
+  bool valid = false;
+
+  if ((window != NULL) && (min != NULL) && (window->count > 0U))
+  {
+    *min = window->samples[window->min.slots[window->min.head]];
+    valid = true;
+  }
+  return valid;
+}
+
+bool RBUF_WindowGetMax(const RBUF_Window_t *window, int32_t *max)
+{
+  bool valid = false;
+
+  if ((window != NULL) && (max != NULL) && (window->count > 0U))
+  {
+    *max = window->samples[window->max.slots[window->max.head]];
+    valid = true;
+  }
+  return valid;
+}
+
+bool RBUF_WindowGetMean(const RBUF_Window_t *window, int32_t *mean)
+{
+  bool valid = false;
+
+  if ((window != NULL) && (mean != NULL) && (window->count > 0U))
+  {
+    *mean = (int32_t) (window->sum / (int64_t) window->count);
+    valid = true;
+  }
+  return valid;
+}
+
+// --- Private functions
+
+static void Rbuf_DequeInit(RBUF_WindowDeque_t *deque, RBUF_size_t *slots)
+{
+  deque->slots = slots;
+  deque->head = 0U;
+  deque->count = 0U;
+}
+
+/**
+ * \brief Get deque back entry position
+ * \param window Owning window
+ * \param deque Deque to check, not empty
+ * \return Position of back entry in deque storage
+ */
+static RBUF_size_t Rbuf_DequeBack(const RBUF_Window_t *window, const RBUF_WindowDeque_t *deque)
+{
+  return (RBUF_size_t) ((deque->head + deque->count - 1U) % window->capacity);
+}
+
+/**
+ * \brief Drop back entries dominated by the new sample, then append its slot
+ * \param window Owning window, new sample already stored
+ * \param deque Deque to update
+ * \param slot New sample slot
+ * \param is_max true for maximum deque, false for minimum deque
+ */
+static void Rbuf_DequePush(const RBUF_Window_t *window, RBUF_WindowDeque_t *deque, RBUF_size_t slot, bool is_max)
+{
+  int32_t sample = window->samples[slot];
+  bool dominated = true;
+
+  while ((deque->count > 0U) && (dominated == true))
+  {
+    int32_t back = window->samples[deque->slots[Rbuf_DequeBack(window, deque)]];
+
+    dominated = (is_max == true) ? (back <= sample) : (back >= sample);
+    if (dominated == true)
+    {
+      deque->count--;
+    }
+  }
+  deque->count++;
+  deque->slots[Rbuf_DequeBack(window, deque)] = slot;
+}
+
+static void Rbuf_DequeEvict(const RBUF_Window_t *window, RBUF_WindowDeque_t *deque, RBUF_size_t slot)
+{
+  if ((deque->count > 0U) && (deque->slots[deque->head] == slot))
+  {
+    deque->head = (RBUF_size_t) ((deque->head + 1U) % window->capacity);
+    deque->count--;
+  }
+}
@@ -0,0 +1,67 @@
+//! \file bm_common.hpp
+//! \brief Ring Buffer benchmark helpers
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+namespace bm
+{
+
+/**
+ * \brief Time a callable
+ * \param function Callable to run
+ * \param iterations Run count
+ * \return Mean duration of one run in nanoseconds
+ */
+template <typename Function> double MeasureNs(Function function, int iterations)
+{
+  auto start = std::chrono::steady_clock::now();
+
+  for (int i = 0; i < iterations; i++)
+  {
+    function();
+  }
+  std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+  return elapsed.count() / iterations;
+}
+
+/**
+ * \brief Accumulate durations of timed sections, to leave setup out of a measurement
+ */
+class Stopwatch
+{
+public:
+  void Start()
+  {
+    start_ = std::chrono::steady_clock::now();
+  }
+  void Stop()
+  {
+    total_ += std::chrono::steady_clock::now() - start_;
+  }
+  double TotalNs() const
+  {
+    return total_.count();
+  }
+
+private:
+  std::chrono::steady_clock::time_point start_;   /*!< Current section start */
+  std::chrono::duration<double, std::nano> total_{}; /*!< Sum of sections */
+};
+
+/**
+ * \brief Print one measurement line
+ * \param name Measured case
+ * \param ns Duration in nanoseconds
+ * \param unit What the duration is for
+ */
+inline void Report(const char *name, double ns, const char *unit)
+{
+  std::printf("%-36s %10.2f ns %s\n", name, ns, unit);
+}
+
+} // namespace bm
@@ -0,0 +1,147 @@
+//! \file bm_rbuf_bulk.cpp
+//! \brief Cache cost of ring copies on code running next to them
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_bulk.h"
+}
+
+#include "bm_common.hpp"
+
+namespace
+{
+
+constexpr std::size_t CHASE_SIZE = 1U << 20U; // Working set, fits a 2 MB L2
+constexpr std::size_t LINE_SIZE = 64U;
+constexpr RBUF_size_t CHUNK_SIZE = 60U * 1024U;
+constexpr RBUF_size_t RING_SIZE = CHUNK_SIZE + 1U;
+constexpr int RING_COUNT = 64;       // Ring storage well above the cache
+constexpr int CHUNKS_PER_PASS = 16;
+constexpr int PASSES = 200;
+
+enum class Copy
+{
+  NONE,
+  REGULAR,
+  BULK,
+};
+
+struct Result
+{
+  double chase_ns; /*!< Mean duration of one chase access */
+  double copy_ns;  /*!< Total time spent in copies */
+};
+
+/**
+ * \brief Link one word per cache line into a single random cycle
+ * \return Chase array, each used word holds the index of the next one
+ */
+std::vector<std::size_t> MakeChase()
+{
+  constexpr std::size_t stride = LINE_SIZE / sizeof(std::size_t);
+  constexpr std::size_t line_count = CHASE_SIZE / LINE_SIZE;
+  std::vector<std::size_t> chase(CHASE_SIZE / sizeof(std::size_t));
+  std::vector<std::size_t> order(line_count);
+  std::mt19937 generator(1U);
+
+  std::iota(order.begin(), order.end(), 0U);
+  std::shuffle(order.begin() + 1, order.end(), generator);
+  for (std::size_t i = 0U; i < line_count; i++)
+  {
+    chase[order[i] * stride] = order[(i + 1U) % line_count] * stride;
+  }
+  return chase;
+}
+
+Result Run(Copy copy, const std::vector<std::size_t> &chase)
+{
+  constexpr std::size_t accesses = CHASE_SIZE / LINE_SIZE;
+  static std::vector<std::uint8_t> ring_data(RING_COUNT * (std::size_t) RING_SIZE);
+  static std::vector<std::uint8_t> src(CHUNK_SIZE, 0xA5);
+  static std::vector<std::uint8_t> dst(CHUNK_SIZE);
+  std::vector<RBUF_t> rings(RING_COUNT);
+  bm::Stopwatch chase_watch;
+  bm::Stopwatch copy_watch;
+  volatile std::size_t sink = 0U; // Keeps the chase alive
+  std::size_t position = 0U;
+  int ring = 0;
+  bool ok = true;
+
+  for (int i = 0; i < RING_COUNT; i++)
+  {
+    RBUF_InitEmpty(&rings[i], &ring_data[i * (std::size_t) RING_SIZE], RING_SIZE);
+  }
+  for (int pass = 0; pass < PASSES; pass++)
+  {
+    copy_watch.Start();
+    for (int chunk = 0; (copy != Copy::NONE) && (chunk < CHUNKS_PER_PASS); chunk++)
+    {
+      BUF_t buf_src;
+      BUF_t buf_dst;
+
+      BUF_InitFull(&buf_src, src.data(), CHUNK_SIZE);
+      BUF_InitEmpty(&buf_dst, dst.data(), CHUNK_SIZE);
+      if (copy == Copy::BULK)
+      {
+        ok &= RBUF_BulkWriteCopy(&rings[ring], &buf_src, CHUNK_SIZE);
+        ok &= RBUF_BulkReadCopyBlock(&buf_dst, &rings[ring], CHUNK_SIZE);
+      }
+      else
+      {
+        ok &= RBUF_WriteCopy(&rings[ring], &buf_src, CHUNK_SIZE);
+        ok &= RBUF_ReadCopyBlock(&buf_dst, &rings[ring], CHUNK_SIZE);
+      }
+      ring = (ring + 1) % RING_COUNT;
+    }
+    copy_watch.Stop();
+
+    chase_watch.Start();
+    for (std::size_t i = 0U; i < accesses; i++)
+    {
+      position = chase[position];
+    }
+    chase_watch.Stop();
+    sink = position;
+  }
+  (void) sink;
+  if (!ok)
+  {
+    std::printf("copy failed\n");
+  }
+  return {chase_watch.TotalNs() / ((double) PASSES * accesses), copy_watch.TotalNs()};
+}
+
+void Print(const char *name, Copy copy, const Result &result)
+{
+  double bytes = 2.0 * CHUNK_SIZE * CHUNKS_PER_PASS * PASSES; // Write and read
+
+  bm::Report(name, result.chase_ns, "per chase access");
+  if (copy != Copy::NONE)
+  {
+    std::printf("%-36s %10.2f GB/s\n", "  copy", bytes / result.copy_ns);
+  }
+}
+
+} // namespace
+
+int main()
+{
+  std::vector<std::size_t> chase = MakeChase();
+
+  std::printf("%u KB chase, %d x %u KB chunks per pass through %d rings, bulk from %u bytes\n",
+              (unsigned) (CHASE_SIZE / 1024U), CHUNKS_PER_PASS, (unsigned) (CHUNK_SIZE / 1024U), RING_COUNT,
+              (unsigned) RBUF_BULK_THRESHOLD);
+  (void) Run(Copy::NONE, chase); // Warm up
+  Print("no copies", Copy::NONE, Run(Copy::NONE, chase));
+  Print("regular path", Copy::REGULAR, Run(Copy::REGULAR, chase));
+  Print("bulk path", Copy::BULK, Run(Copy::BULK, chase));
+  return 0;
+}
@@ -0,0 +1,128 @@
+//! \file bm_rbuf_compress.cpp
+//! \brief Delta+RLE compression ratio and throughput on sensor frames
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_compress.h"
+}
+
+#include "bm_common.hpp"
+
+namespace
+{
+
+constexpr int FRAME_SIZE = 16;
+constexpr int FRAME_COUNT = 256; // 4 KB per run
+constexpr uint16_t BLOCK_SIZE = 1024U;
+constexpr RBUF_size_t RING_SIZE = 8192U;
+constexpr int ITERATIONS = 5000;
+
+/**
+ * \brief Build frames of an IMU-like sensor: sync word, sequence counter, slow temperature, noisy axes, status
+ * \param noise_bits Random low bits on each axis, 0 for a sensor at rest
+ * \return Frames
+ */
+std::vector<std::uint8_t> MakeSensorFrames(unsigned noise_bits)
+{
+  std::vector<std::uint8_t> frames;
+  std::uint32_t seed = 12345U;
+
+  for (int i = 0; i < FRAME_COUNT; i++)
+  {
+    std::uint8_t frame[FRAME_SIZE] = {0xA5, 0x5A, (std::uint8_t) i, (std::uint8_t) (i >> 8)};
+    std::uint16_t temperature = (std::uint16_t) (2500 + i / 32);
+
+    frame[4] = (std::uint8_t) temperature;
+    frame[5] = (std::uint8_t) (temperature >> 8);
+    for (int axis = 0; axis < 3; axis++)
+    {
+      seed = seed * 1103515245U + 12345U;
+      std::uint16_t value = (std::uint16_t) ((axis == 2) ? 16384 : 0);
+      value = (std::uint16_t) (value + ((seed >> 16) & ((1U << noise_bits) - 1U)));
+      frame[6 + 2 * axis] = (std::uint8_t) value;
+      frame[7 + 2 * axis] = (std::uint8_t) (value >> 8);
+    }
+    frame[15] = 0x01; // Status
+    frames.insert(frames.end(), frame, frame + FRAME_SIZE);
+  }
+  return frames;
+}
+
+/**
+ * \brief Report ratio and throughput for one data set
+ * \param name Data set
+ * \param frames Raw bytes
+ * \param stride Delta distance
+ * \return true if data round-trips
+ */
+bool Run(const char *name, const std::vector<std::uint8_t> &frames, uint8_t stride)
+{
+  static std::uint8_t ring_data[RING_SIZE];
+  static std::uint8_t block[BLOCK_SIZE];
+  static std::uint8_t out_data[BLOCK_SIZE];
+  std::vector<std::uint8_t> decoded;
+  RBUF_t rbuf;
+  RBUF_t compressed;
+  RBUF_Compress_t compress;
+  BUF_t out;
+  bool ok = true;
+
+  auto compress_all = [&]() {
+    RBUF_InitEmpty(&rbuf, ring_data, RING_SIZE);
+    RBUF_CompressInit(&compress, &rbuf, block, BLOCK_SIZE, stride);
+    ok &= (RBUF_CompressWrite(&compress, frames.data(), (RBUF_size_t) frames.size()) == frames.size());
+    ok &= RBUF_CompressFlush(&compress);
+  };
+  auto decompress_all = [&]() {
+    RBUF_t ring = compressed;
+
+    decoded.clear();
+    BUF_InitEmpty(&out, out_data, sizeof(out_data));
+    while (RBUF_DecompressRead(&out, &ring, stride) == true)
+    {
+      decoded.insert(decoded.end(), out_data, out_data + out.write_index);
+      BUF_InitEmpty(&out, out_data, sizeof(out_data));
+    }
+  };
+
+  double compress_ns = bm::MeasureNs(compress_all, ITERATIONS);
+  compressed = rbuf;
+  double decompress_ns = bm::MeasureNs(decompress_all, ITERATIONS);
+  ok &= (decoded == frames);
+
+  std::printf("%-24s %5u -> %5u bytes, ratio %5.2f, compress %7.1f MB/s, decompress %7.1f MB/s\n", name,
+              (unsigned) compress.raw_size, (unsigned) compress.compressed_size,
+              (double) compress.raw_size / compress.compressed_size, frames.size() * 1e3 / compress_ns,
+              frames.size() * 1e3 / decompress_ns);
+  return ok;
+}
+
+} // namespace
+
+int main()
+{
+  std::vector<std::uint8_t> random(FRAME_SIZE * FRAME_COUNT);
+  std::uint32_t seed = 1U;
+  bool ok = true;
+
+  for (std::uint8_t &byte : random)
+  {
+    seed = seed * 1103515245U + 12345U;
+    byte = (std::uint8_t) (seed >> 16);
+  }
+  ok &= Run("sensor at rest", MakeSensorFrames(0U), FRAME_SIZE);
+  ok &= Run("sensor, 4 bit noise", MakeSensorFrames(4U), FRAME_SIZE);
+  ok &= Run("sensor, stride 1", MakeSensorFrames(4U), 1U);
+  ok &= Run("random, worst case", random, FRAME_SIZE);
+  if (ok == false)
+  {
+    std::printf("round trip mismatch\n");
+  }
+  return (ok == true) ? 0 : 1;
+}
@@ -0,0 +1,115 @@
+//! \file bm_rbuf_frame.cpp
+//! \brief In-place COBS decoding against a byte by byte decoder
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_frame.h"
+}
+
+#include "bm_common.hpp"
+
+namespace
+{
+
+constexpr int FRAME_SIZE = 200;
+constexpr int FRAME_COUNT = 16;
+constexpr int ITERATIONS = 20000;
+
+/**
+ * \brief Decode one COBS frame with RBUF_ReadUint8, the way a UART driver state machine does
+ * \param buf_dst Destination buffer, large enough
+ * \param rbuf_src Ring holding encoded frames
+ * \return true if a delimiter was reached
+ */
+bool CobsDecodeBytewise(BUF_t *buf_dst, RBUF_t *rbuf_src)
+{
+  std::uint8_t code = 0xFFU;
+  std::uint8_t left = 0U;
+  bool decoded = false;
+
+  while ((decoded == false) && (RBUF_IsEmpty(rbuf_src) == false))
+  {
+    std::uint8_t byte = RBUF_ReadUint8(rbuf_src);
+
+    if (byte == 0U)
+    {
+      decoded = true;
+    }
+    else if (left == 0U)
+    {
+      if (code != 0xFFU)
+      {
+        buf_dst->data[buf_dst->write_index++] = 0U;
+      }
+      code = byte;
+      left = (std::uint8_t) (byte - 1U);
+    }
+    else
+    {
+      buf_dst->data[buf_dst->write_index++] = byte;
+      left--;
+    }
+  }
+  return decoded;
+}
+
+} // namespace
+
+int main()
+{
+  static std::uint8_t ring_data[4096];
+  static std::uint8_t out_data[FRAME_SIZE];
+  std::uint8_t frame[FRAME_SIZE];
+  RBUF_t encoded;
+  BUF_t out;
+  int errors = 0;
+
+  for (int i = 0; i < FRAME_SIZE; i++)
+  {
+    frame[i] = ((i % 50) == 0) ? 0U : (std::uint8_t) (i * 7 + 1);
+  }
+  RBUF_InitEmpty(&encoded, ring_data, sizeof(ring_data));
+  encoded.write_index = encoded.read_index = sizeof(ring_data) / 2U; // Frames wrap
+  for (int i = 0; i < FRAME_COUNT; i++)
+  {
+    (void) RBUF_CobsEncode(&encoded, frame, FRAME_SIZE);
+  }
+
+  auto decode = [&](bool (*decoder)(BUF_t *, RBUF_t *)) {
+    RBUF_t rbuf = encoded;
+
+    for (int i = 0; i < FRAME_COUNT; i++)
+    {
+      BUF_InitEmpty(&out, out_data, sizeof(out_data));
+      errors += (decoder(&out, &rbuf) == false) || (std::memcmp(out_data, frame, FRAME_SIZE) != 0);
+    }
+  };
+  auto encode = [&]() {
+    RBUF_t rbuf = encoded;
+
+    rbuf.write_index = rbuf.read_index;
+    for (int i = 0; i < FRAME_COUNT; i++)
+    {
+      errors += (RBUF_CobsEncode(&rbuf, frame, FRAME_SIZE) == false);
+    }
+  };
+  auto in_place = [](BUF_t *buf_dst, RBUF_t *rbuf_src) {
+    return RBUF_CobsDecode(buf_dst, rbuf_src) == RBUF_FRAME_DECODED;
+  };
+  const double bytes = (double) FRAME_SIZE * FRAME_COUNT;
+
+  bm::Report("cobs encode", bm::MeasureNs(encode, ITERATIONS) / bytes, "per byte");
+  bm::Report("cobs decode, in place", bm::MeasureNs([&]() { decode(in_place); }, ITERATIONS) / bytes, "per byte");
+  bm::Report("cobs decode, RBUF_ReadUint8", bm::MeasureNs([&]() { decode(CobsDecodeBytewise); }, ITERATIONS) / bytes,
+             "per byte");
+  if (errors != 0)
+  {
+    std::printf("%d decoding errors\n", errors);
+  }
+  return (errors == 0) ? 0 : 1;
+}
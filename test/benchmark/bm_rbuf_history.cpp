@@ -0,0 +1,116 @@
+//! \file bm_rbuf_history.cpp
+//! \brief Push plus FIR per sample, SIMD kernel against scalar and modulo indexed loops
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_history.h"
+}
+
+#include "bm_common.hpp"
+
+namespace
+{
+
+constexpr RBUF_size_t CAPACITY = 1024U;
+constexpr int SAMPLES = 20000;
+
+/**
+ * \brief Scalar dot product, the loop the library falls back to without SIMD
+ */
+float DotScalar(const float *a, const float *b, RBUF_size_t length)
+{
+  float sum = 0.0F;
+
+  for (RBUF_size_t i = 0U; i < length; i++)
+  {
+    sum += a[i] * b[i];
+  }
+  return sum;
+}
+
+/**
+ * \brief Plain ring of samples, the window is indexed modulo capacity
+ */
+struct ModuloRing
+{
+  std::vector<float> data;
+  std::size_t capacity; // Not a constant, keeps the modulo a division
+  std::size_t index = 0U;
+
+  float Fir(const float *taps, std::size_t tap_count) const
+  {
+    float sum = 0.0F;
+
+    for (std::size_t k = 0U; k < tap_count; k++)
+    {
+      sum += data[(index + capacity - tap_count + k) % capacity] * taps[k];
+    }
+    return sum;
+  }
+};
+
+float Sample(int i)
+{
+  return (float) ((i * 37) % 101) * 0.01F;
+}
+
+} // namespace
+
+int main()
+{
+  static float storage[RBUF_HISTORY_STORAGE_SIZE(CAPACITY)];
+  volatile std::size_t capacity = CAPACITY;
+  volatile float sink = 0.0F; // Keeps results alive
+  RBUF_History_t history;
+  ModuloRing ring = {std::vector<float>(capacity), capacity};
+
+#if defined(__AVX__)
+  const char *kernel = "AVX";
+#elif defined(__SSE__)
+  const char *kernel = "SSE";
+#elif defined(__ARM_NEON)
+  const char *kernel = "NEON";
+#else
+  const char *kernel = "scalar";
+#endif
+
+  RBUF_HistoryInit(&history, storage, CAPACITY);
+  for (RBUF_size_t i = 0U; i < CAPACITY; i++)
+  {
+    (void) RBUF_HistoryPush(&history, Sample(i));
+    ring.data[i] = Sample(i);
+  }
+
+  std::printf("push + FIR per sample, Msample/s, library kernel %s\n", kernel);
+  std::printf("%6s %12s %12s %12s\n", "taps", "kernel", "scalar", "modulo");
+  for (RBUF_size_t tap_count : {16U, 64U, 256U, 1024U})
+  {
+    std::vector<float> taps(tap_count, 1.0F / (float) tap_count);
+    int n = 0;
+
+    auto simd = [&]() {
+      float output = 0.0F;
+      (void) RBUF_HistoryPush(&history, Sample(n++));
+      (void) RBUF_HistoryFir(&history, taps.data(), tap_count, &output);
+      sink = sink + output;
+    };
+    auto scalar = [&]() {
+      (void) RBUF_HistoryPush(&history, Sample(n++));
+      sink = sink + DotScalar(RBUF_HistoryGetWindow(&history, tap_count), taps.data(), tap_count);
+    };
+    auto modulo = [&]() {
+      ring.data[ring.index] = Sample(n++);
+      ring.index = (ring.index + 1U) % ring.capacity;
+      sink = sink + ring.Fir(taps.data(), tap_count);
+    };
+
+    std::printf("%6u %12.1f %12.1f %12.1f\n", (unsigned) tap_count, 1e3 / bm::MeasureNs(simd, SAMPLES),
+                1e3 / bm::MeasureNs(scalar, SAMPLES), 1e3 / bm::MeasureNs(modulo, SAMPLES));
+  }
+  return 0;
+}
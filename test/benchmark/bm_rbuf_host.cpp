@@ -0,0 +1,158 @@
+//! \file bm_rbuf_host.cpp
+//! \brief Ring storage on regular, transparent huge and explicit huge pages
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_host.h"
+}
+
+#include "bm_common.hpp"
+
+namespace
+{
+
+constexpr std::size_t STORAGE_SIZE = 256U * 1024U * 1024U;
+constexpr std::size_t PAGE_SIZE = 4096U;
+constexpr std::size_t LINE_SIZE = 64U;
+// One ring over the whole storage with RBUF_CFG_SIZE_32BIT, else as many rings as fit
+constexpr std::size_t RING_SIZE = std::min<std::size_t>(STORAGE_SIZE, std::numeric_limits<RBUF_size_t>::max());
+constexpr RBUF_size_t CHUNK_SIZE = 4096U;
+constexpr int TRAFFIC_PASSES = 4;
+constexpr int CHASE_PASSES = 8;
+
+const char *PagesName(RBUF_HostPages_t pages)
+{
+  const char *name = "4 KB pages";
+
+  if (pages == RBUF_HOST_PAGES_THP)
+  {
+    name = "transparent huge pages";
+  }
+  else if (pages == RBUF_HOST_PAGES_HUGE)
+  {
+    name = "explicit huge pages";
+  }
+  return name;
+}
+
+/**
+ * \brief Push storage sized traffic through the rings laid over it
+ * \param base Storage
+ * \return Throughput in GB/s, write and read counted
+ */
+double RingTraffic(std::uint8_t *base)
+{
+  static std::uint8_t chunk_src[CHUNK_SIZE];
+  static std::uint8_t chunk_dst[CHUNK_SIZE];
+  std::size_t ring_count = STORAGE_SIZE / RING_SIZE;
+  std::vector<RBUF_t> rings(ring_count);
+  bm::Stopwatch watch;
+  bool ok = true;
+
+  std::memset(chunk_src, 0x5A, sizeof(chunk_src));
+  for (std::size_t i = 0U; i < ring_count; i++)
+  {
+    RBUF_InitEmpty(&rings[i], &base[i * RING_SIZE], (RBUF_size_t) RING_SIZE);
+  }
+  watch.Start();
+  for (int pass = 0; pass < TRAFFIC_PASSES; pass++)
+  {
+    for (RBUF_t &rbuf : rings)
+    {
+      while (RBUF_GetFreeSize(&rbuf) >= CHUNK_SIZE)
+      {
+        ok &= RBUF_WriteString(&rbuf, (const char *) chunk_src, CHUNK_SIZE);
+      }
+      while (RBUF_GetUsedSize(&rbuf) >= CHUNK_SIZE)
+      {
+        BUF_t buf_dst;
+
+        BUF_InitEmpty(&buf_dst, chunk_dst, CHUNK_SIZE);
+        ok &= (RBUF_ReadCopyRaw(&buf_dst, &rbuf, CHUNK_SIZE) == CHUNK_SIZE);
+      }
+    }
+  }
+  watch.Stop();
+  if (!ok)
+  {
+    std::printf("ring traffic failed\n");
+  }
+  return 2.0 * (double) (ring_count * (RING_SIZE / CHUNK_SIZE) * CHUNK_SIZE) * TRAFFIC_PASSES / watch.TotalNs();
+}
+
+/**
+ * \brief Chase a random cycle through every 4 KB page of the storage
+ * \param base Storage
+ * \return Mean duration of one access in nanoseconds
+ */
+double PageChase(std::uint8_t *base)
+{
+  constexpr std::size_t page_count = STORAGE_SIZE / PAGE_SIZE;
+  std::vector<std::size_t> order(page_count);
+  std::mt19937 generator(1U);
+  volatile std::size_t sink = 0U; // Keeps the chase alive
+  std::size_t *slot = nullptr;
+  std::size_t offset = 0U;
+
+  std::iota(order.begin(), order.end(), 0U);
+  std::shuffle(order.begin() + 1, order.end(), generator);
+  // Vary the line inside each page so slots do not share cache sets
+  auto slot_offset = [](std::size_t page) { return page * PAGE_SIZE + (page % (PAGE_SIZE / LINE_SIZE)) * LINE_SIZE; };
+  for (std::size_t i = 0U; i < page_count; i++)
+  {
+    slot = reinterpret_cast<std::size_t *>(&base[slot_offset(order[i])]);
+    *slot = slot_offset(order[(i + 1U) % page_count]);
+  }
+
+  double ns = bm::MeasureNs(
+    [&]() {
+      for (std::size_t i = 0U; i < page_count; i++)
+      {
+        offset = *reinterpret_cast<std::size_t *>(&base[offset]);
+      }
+    },
+    CHASE_PASSES);
+  sink = offset;
+  (void) sink;
+  return ns / page_count;
+}
+
+} // namespace
+
+int main()
+{
+  char name[64];
+
+  std::printf("%u MB storage as %u x %u byte rings\n", (unsigned) (STORAGE_SIZE >> 20U),
+              (unsigned) (STORAGE_SIZE / RING_SIZE), (unsigned) RING_SIZE);
+  for (RBUF_HostPages_t pages : {RBUF_HOST_PAGES_DEFAULT, RBUF_HOST_PAGES_THP, RBUF_HOST_PAGES_HUGE})
+  {
+    RBUF_HostMem_t mem;
+
+    if (!RBUF_HostAlloc(&mem, STORAGE_SIZE, pages, RBUF_HOST_NODE_NONE))
+    {
+      std::printf("%s: mapping failed\n", PagesName(pages));
+      continue;
+    }
+    if (mem.pages != pages)
+    {
+      std::printf("%s unavailable, fell back to %s\n", PagesName(pages), PagesName(mem.pages));
+    }
+    std::snprintf(name, sizeof(name), "%s, random page", PagesName(mem.pages));
+    bm::Report(name, PageChase((std::uint8_t *) mem.base), "per access");
+    std::snprintf(name, sizeof(name), "%s, ring traffic", PagesName(mem.pages));
+    std::printf("%-36s %10.2f GB/s\n", name, RingTraffic((std::uint8_t *) mem.base));
+    RBUF_HostFree(&mem);
+  }
+  return 0;
+}
@@ -0,0 +1,72 @@
+//! \file bm_rbuf_unchecked.cpp
+//! \brief Inline unchecked byte access against the checked API
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <cstdint>
+#include <cstdio>
+
+extern "C" {
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_unchecked.h"
+}
+
+#include "bm_common.hpp"
+
+namespace
+{
+
+constexpr RBUF_size_t DATA_SIZE = 256U;
+constexpr RBUF_size_t BURST = 64U;
+constexpr int ITERATIONS = 2000000;
+
+} // namespace
+
+int main()
+{
+  static std::uint8_t data[DATA_SIZE];
+  volatile std::uint8_t sink = 0U; // Keeps results alive
+  RBUF_t rbuf;
+
+  RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+
+  auto checked_pair = [&]() {
+    (void) RBUF_WriteUint8(&rbuf, 0x5A);
+    sink = RBUF_ReadUint8(&rbuf);
+  };
+  auto unchecked_pair = [&]() {
+    std::uint8_t byte = 0U;
+    (void) RBUF_UncheckedWriteUint8(&rbuf, 0x5A);
+    (void) RBUF_UncheckedReadUint8(&rbuf, &byte);
+    sink = byte;
+  };
+  auto checked_burst = [&]() {
+    for (RBUF_size_t i = 0U; i < BURST; i++)
+    {
+      (void) RBUF_WriteUint8(&rbuf, (std::uint8_t) i);
+    }
+    for (RBUF_size_t i = 0U; i < BURST; i++)
+    {
+      sink = RBUF_ReadUint8(&rbuf);
+    }
+  };
+  auto unchecked_burst = [&]() {
+    std::uint8_t byte = 0U;
+    for (RBUF_size_t i = 0U; i < BURST; i++)
+    {
+      (void) RBUF_UncheckedWriteUint8(&rbuf, (std::uint8_t) i);
+    }
+    for (RBUF_size_t i = 0U; i < BURST; i++)
+    {
+      (void) RBUF_UncheckedReadUint8(&rbuf, &byte);
+    }
+    sink = byte;
+  };
+
+  std::printf("%u byte ring\n", (unsigned) DATA_SIZE);
+  bm::Report("checked push + pop", bm::MeasureNs(checked_pair, ITERATIONS), "per pair");
+  bm::Report("unchecked push + pop", bm::MeasureNs(unchecked_pair, ITERATIONS), "per pair");
+  bm::Report("checked 64 push, 64 pop", bm::MeasureNs(checked_burst, ITERATIONS / 64) / BURST, "per pair");
+  bm::Report("unchecked 64 push, 64 pop", bm::MeasureNs(unchecked_burst, ITERATIONS / 64) / BURST, "per pair");
+  return 0;
+}
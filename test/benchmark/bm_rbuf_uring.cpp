@@ -0,0 +1,173 @@
+//! \file bm_rbuf_uring.cpp
+//! \brief Filling many rings from sockets, io_uring against epoll and readv
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstdio>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_uring.h"
+}
+
+#include "bm_common.hpp"
+
+namespace
+{
+
+constexpr int STREAM_COUNT = 64;
+constexpr RBUF_size_t RING_SIZE = 8192U;
+constexpr RBUF_size_t CHUNK_SIZE = 1024U;
+constexpr int ROUNDS = 3000;
+
+std::uint8_t storage[STREAM_COUNT][RING_SIZE];
+std::uint8_t chunk[CHUNK_SIZE];
+RBUF_t rings[STREAM_COUNT];
+int sockets[STREAM_COUNT][2];
+
+/**
+ * \brief Count rings not holding a whole chunk yet
+ * \return Ring count
+ */
+int CountPending()
+{
+  int pending = 0;
+
+  for (int i = 0; i < STREAM_COUNT; i++)
+  {
+    pending += (RBUF_GetUsedSize(&rings[i]) < CHUNK_SIZE);
+  }
+  return pending;
+}
+
+/**
+ * \brief Wait for readable sockets, then one readv per socket into the ring free spans
+ * \param epoll_fd epoll instance watching every socket
+ * \return true if every ring received its chunk
+ */
+bool FillEpoll(int epoll_fd)
+{
+  bool filled = true;
+
+  while ((filled == true) && (CountPending() > 0))
+  {
+    struct epoll_event events[STREAM_COUNT];
+    int count = epoll_wait(epoll_fd, events, STREAM_COUNT, -1);
+
+    filled = (count > 0);
+    for (int k = 0; k < count; k++)
+    {
+      RBUF_t *ring = &rings[events[k].data.u32];
+      RBUF_Span_t spans[2];
+      (void) RBUF_WriteReserve(ring, spans);
+      struct iovec iov[2] = {{spans[0].data, spans[0].size}, {spans[1].data, spans[1].size}};
+      ssize_t size = readv(sockets[events[k].data.u32][0], iov, (spans[1].size > 0U) ? 2 : 1);
+
+      if (size > 0)
+      {
+        (void) RBUF_WriteCommit(ring, (RBUF_size_t) size);
+      }
+    }
+  }
+  return filled;
+}
+
+/**
+ * \brief Queue a read on every ring short of its chunk, submit and wait for them in one io_uring_enter
+ * \param uring io_uring instance
+ * \param streams Streams filling the rings
+ * \return true if every ring received its chunk
+ */
+bool FillUring(RBUF_Uring_t *uring, RBUF_UringStream_t *streams)
+{
+  bool filled = true;
+
+  while ((filled == true) && (CountPending() > 0))
+  {
+    std::uint32_t busy = 0U;
+
+    for (int i = 0; i < STREAM_COUNT; i++)
+    {
+      if ((streams[i].busy == false) && (RBUF_GetUsedSize(&rings[i]) < CHUNK_SIZE))
+      {
+        (void) RBUF_UringQueue(uring, &streams[i]);
+      }
+      busy += (streams[i].busy == true);
+    }
+    filled = (RBUF_UringSubmit(uring, busy) >= 0);
+  }
+  return filled;
+}
+
+} // namespace
+
+int main()
+{
+  static RBUF_UringStream_t streams[STREAM_COUNT];
+  RBUF_UringStream_t *registered[STREAM_COUNT];
+  RBUF_Uring_t uring = {}; // Destroy is a no-op unless init succeeded
+  int epoll_fd = epoll_create1(0);
+  int opened = 0;
+  bool ok = (epoll_fd >= 0);
+
+  for (int i = 0; (i < STREAM_COUNT) && (ok == true); i++)
+  {
+    struct epoll_event event = {};
+
+    ok = (socketpair(AF_UNIX, SOCK_STREAM, 0, sockets[i]) == 0);
+    opened += (ok == true);
+    event.events = EPOLLIN;
+    event.data.u32 = (std::uint32_t) i;
+    ok = ok && (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, sockets[i][0], &event) == 0);
+    RBUF_InitEmpty(&rings[i], storage[i], RING_SIZE);
+    RBUF_UringStreamInit(&streams[i], &rings[i], sockets[i][0], RBUF_URING_FILL, RBUF_URING_OFFSET_NONE);
+    registered[i] = &streams[i];
+  }
+  if ((ok == true) && (RBUF_UringInit(&uring, STREAM_COUNT) == false))
+  {
+    std::printf("io_uring not available\n");
+    ok = false;
+  }
+
+  const char *names[] = {"epoll_wait + readv per socket", "io_uring", "io_uring, fixed buffers"};
+  std::printf("%d sockets, %u bytes pending on each\n", STREAM_COUNT, (unsigned) CHUNK_SIZE);
+  for (int mode = 0; (mode < 3) && (ok == true); mode++)
+  {
+    bm::Stopwatch stopwatch;
+
+    if ((mode == 2) && (RBUF_UringRegister(&uring, registered, STREAM_COUNT) == false))
+    {
+      std::printf("%s: registration refused\n", names[mode]);
+      break;
+    }
+    for (int round = 0; (round < ROUNDS) && (ok == true); round++)
+    {
+      for (int i = 0; i < STREAM_COUNT; i++)
+      {
+        ok = ok && (write(sockets[i][1], chunk, CHUNK_SIZE) == (ssize_t) CHUNK_SIZE);
+        rings[i].read_index = rings[i].write_index;
+      }
+      stopwatch.Start();
+      ok = ok && ((mode == 0) ? FillEpoll(epoll_fd) : FillUring(&uring, streams));
+      stopwatch.Stop();
+    }
+    bm::Report(names[mode], stopwatch.TotalNs() / ROUNDS, "per round");
+  }
+
+  RBUF_UringDestroy(&uring);
+  for (int i = 0; i < opened; i++)
+  {
+    (void) close(sockets[i][0]);
+    (void) close(sockets[i][1]);
+  }
+  if (epoll_fd >= 0)
+  {
+    (void) close(epoll_fd);
+  }
+  return (ok == true) ? 0 : 1;
+}
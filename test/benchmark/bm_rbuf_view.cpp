@@ -0,0 +1,62 @@
+//! \file bm_rbuf_view.cpp
+//! \brief STL view over wrapped ring contents against a linear array
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include "ring_buffer/ring_buffer_view.hpp"
+
+#include "bm_common.hpp"
+
+namespace
+{
+
+constexpr RBUF_size_t DATA_SIZE = 4096U;
+constexpr int ITERATIONS = 200000;
+
+} // namespace
+
+int main()
+{
+  static std::uint8_t ring_data[DATA_SIZE + 1U];
+  std::vector<std::uint8_t> array(DATA_SIZE);
+  volatile long sink = 0; // Keeps results alive
+  RBUF_t rbuf;
+
+  RBUF_InitEmpty(&rbuf, ring_data, sizeof(ring_data));
+  rbuf.write_index = rbuf.read_index = DATA_SIZE / 2U; // Contents wrap in the middle
+  for (RBUF_size_t i = 0U; i < DATA_SIZE; i++)
+  {
+    std::uint8_t byte = (i == DATA_SIZE - 1U) ? 0U : (std::uint8_t) (i * 13U % 251U + 1U); // Zero found last
+
+    (void) RBUF_WriteUint8(&rbuf, byte);
+    array[i] = byte;
+  }
+
+  auto accumulate_array = [&]() { sink += std::accumulate(array.begin(), array.end(), 0L); };
+  auto accumulate_iterators = [&]() {
+    rbuf::View view(rbuf);
+    sink += std::accumulate(view.begin(), view.end(), 0L);
+  };
+  auto accumulate_segmented = [&]() { sink += rbuf::View(rbuf).Accumulate(0L); };
+  auto find_array = [&]() { sink += std::find(array.begin(), array.end(), 0U) - array.begin(); };
+  auto find_iterators = [&]() {
+    rbuf::View view(rbuf);
+    sink += std::find(view.begin(), view.end(), 0U) - view.begin();
+  };
+  auto find_segmented = [&]() { sink += (long) rbuf::View(rbuf).Find(0U).Position(); };
+
+  std::printf("%u bytes, wrapped in the middle\n", (unsigned) DATA_SIZE);
+  bm::Report("accumulate, array", bm::MeasureNs(accumulate_array, ITERATIONS), "per scan");
+  bm::Report("accumulate, view iterators", bm::MeasureNs(accumulate_iterators, ITERATIONS), "per scan");
+  bm::Report("accumulate, view segmented", bm::MeasureNs(accumulate_segmented, ITERATIONS), "per scan");
+  bm::Report("find, array", bm::MeasureNs(find_array, ITERATIONS), "per scan");
+  bm::Report("find, view iterators", bm::MeasureNs(find_iterators, ITERATIONS), "per scan");
+  bm::Report("find, view segmented", bm::MeasureNs(find_segmented, ITERATIONS), "per scan");
+  return 0;
+}
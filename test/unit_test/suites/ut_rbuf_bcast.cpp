@@ -0,0 +1,180 @@
+//! \file ut_rbuf_bcast.cpp
+//! \brief Broadcast Ring Buffer unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gmock/gmock.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_bcast.h"
+#include "ring_buffer/ring_buffer_set.h"
+}
+
+using namespace testing;
+using testing::ElementsAreArray;
+
+class RBUF_Bcast_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_BcastInit(&bcast, data, DATA_SIZE, RBUF_BCAST_BLOCK);
+    BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+  }
+  // attributes
+  static constexpr uint8_t DATA_SIZE = 10;
+
+  RBUF_Bcast_t bcast;
+  std::uint8_t data[DATA_SIZE];
+
+  BUF_t buf;
+  std::uint8_t buf_data[DATA_SIZE];
+};
+
+/**
+ * \brief Each reader receives every byte written once
+ */
+TEST_F(RBUF_Bcast_Fixture, bcast_001)
+{
+  uint8_t r0, r1;
+  ASSERT_TRUE(RBUF_BcastAttach(&bcast, &r0));
+  ASSERT_TRUE(RBUF_BcastAttach(&bcast, &r1));
+  EXPECT_NE(r0, r1);
+
+  EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "Hello", 5));
+  EXPECT_EQ(RBUF_BcastGetUsedSize(&bcast, r0), 5);
+  EXPECT_EQ(RBUF_BcastGetUsedSize(&bcast, r1), 5);
+
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r0, DATA_SIZE), 5);
+  std::vector<std::uint8_t> expected = {'H', 'e', 'l', 'l', 'o'};
+  EXPECT_THAT(expected, ElementsAreArray(buf.data, 5));
+  EXPECT_EQ(RBUF_BcastGetUsedSize(&bcast, r0), 0);
+  EXPECT_EQ(RBUF_BcastGetUsedSize(&bcast, r1), 5);
+
+  /* Free space follows the slowest reader */
+  EXPECT_EQ(RBUF_BcastGetFreeSize(&bcast), DATA_SIZE - 1 - 5);
+
+  BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r1, 2), 2);
+  EXPECT_THAT(std::vector<std::uint8_t>({'H', 'e'}), ElementsAreArray(buf.data, 2));
+  EXPECT_EQ(RBUF_BcastGetFreeSize(&bcast), DATA_SIZE - 1 - 3);
+}
+
+/**
+ * \brief Block policy: write fails when the slowest reader has no room
+ */
+TEST_F(RBUF_Bcast_Fixture, bcast_002)
+{
+  uint8_t r0, r1;
+  RBUF_BcastAttach(&bcast, &r0);
+  RBUF_BcastAttach(&bcast, &r1);
+
+  EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "abcdefgh", 8));
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r0, 8), 8);
+  EXPECT_FALSE(RBUF_BcastWriteString(&bcast, "ij", 2));
+  EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "i", 1));
+}
+
+/**
+ * \brief Evict policy: slow reader is detached
+ */
+TEST_F(RBUF_Bcast_Fixture, bcast_003)
+{
+  uint8_t r0, r1;
+  RBUF_BcastInit(&bcast, data, DATA_SIZE, RBUF_BCAST_EVICT);
+  RBUF_BcastAttach(&bcast, &r0);
+  RBUF_BcastAttach(&bcast, &r1);
+
+  EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "abcdefgh", 8));
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r0, 8), 8);
+  EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "ijkl", 4));
+  EXPECT_TRUE(RBUF_BcastIsAttached(&bcast, r0));
+  EXPECT_FALSE(RBUF_BcastIsAttached(&bcast, r1));
+  EXPECT_EQ(RBUF_BcastGetUsedSize(&bcast, r0), 4);
+
+  /* Evicted slot is available again */
+  uint8_t r2;
+  EXPECT_TRUE(RBUF_BcastAttach(&bcast, &r2));
+  EXPECT_EQ(r2, r1);
+  EXPECT_EQ(RBUF_BcastGetUsedSize(&bcast, r2), 0);
+}
+
+/**
+ * \brief Lap policy: slow reader loses its oldest data
+ */
+TEST_F(RBUF_Bcast_Fixture, bcast_004)
+{
+  uint8_t r0, r1;
+  RBUF_BcastInit(&bcast, data, DATA_SIZE, RBUF_BCAST_LAP);
+  RBUF_BcastAttach(&bcast, &r0);
+  RBUF_BcastAttach(&bcast, &r1);
+
+  EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "abcdefgh", 8));
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r0, 8), 8);
+  EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "ijkl", 4));
+  EXPECT_TRUE(RBUF_BcastIsAttached(&bcast, r1));
+  EXPECT_EQ(RBUF_BcastGetLostSize(&bcast, r1), 3U);
+  EXPECT_EQ(RBUF_BcastGetUsedSize(&bcast, r1), 9);
+
+  BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r1, DATA_SIZE), 9);
+  EXPECT_THAT(std::vector<std::uint8_t>({'d', 'e', 'f', 'g', 'h', 'i', 'j', 'k', 'l'}), ElementsAreArray(buf.data, 9));
+}
+
+/**
+ * \brief Without reader, writes always succeed and are dropped
+ */
+TEST_F(RBUF_Bcast_Fixture, bcast_005)
+{
+  for (int i = 0; i < 5; i++)
+  {
+    EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "abcdefgh", 8));
+  }
+  EXPECT_EQ(RBUF_BcastGetFreeSize(&bcast), DATA_SIZE - 1);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Bcast_Fixture, bcast_006)
+{
+  uint8_t r0;
+  EXPECT_FALSE(RBUF_BcastAttach(nullptr, &r0));
+  EXPECT_FALSE(RBUF_BcastAttach(&bcast, nullptr));
+  for (uint8_t i = 0; i < RBUF_BCAST_READER_MAX; i++)
+  {
+    EXPECT_TRUE(RBUF_BcastAttach(&bcast, &r0));
+  }
+  EXPECT_FALSE(RBUF_BcastAttach(&bcast, &r0));
+  EXPECT_FALSE(RBUF_BcastWriteString(nullptr, "a", 1));
+  EXPECT_FALSE(RBUF_BcastWriteString(&bcast, "abcdefghij", DATA_SIZE));
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, RBUF_BCAST_READER_MAX, 1), 0);
+  EXPECT_EQ(RBUF_BcastGetUsedSize(nullptr, 0), 0);
+  EXPECT_FALSE(RBUF_BcastIsAttached(&bcast, RBUF_BCAST_READER_MAX));
+}
+
+/**
+ * \brief Ring stays ready in a ring set until every reader is drained
+ */
+TEST_F(RBUF_Bcast_Fixture, bcast_007)
+{
+  RBUF_t *rings[1];
+  uint32_t ready[RBUF_SET_WORDS(1)];
+  RBUF_Set_t set;
+  uint16_t id;
+  uint8_t r0, r1;
+
+  RBUF_SetInit(&set, rings, ready, 1);
+  ASSERT_TRUE(RBUF_SetAdd(&set, &bcast.ring, 0));
+  ASSERT_TRUE(RBUF_BcastAttach(&bcast, &r0));
+  ASSERT_TRUE(RBUF_BcastAttach(&bcast, &r1));
+  EXPECT_TRUE(RBUF_BcastWriteString(&bcast, "abc", 3));
+  EXPECT_TRUE(RBUF_SetFirstReady(&set, &id));
+
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r0, DATA_SIZE), 3);
+  EXPECT_TRUE(RBUF_SetFirstReady(&set, &id));
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r1, 2), 2);
+  EXPECT_TRUE(RBUF_SetFirstReady(&set, &id));
+  EXPECT_EQ(RBUF_BcastReadCopyRaw(&buf, &bcast, r1, 1), 1);
+  EXPECT_FALSE(RBUF_SetFirstReady(&set, &id));
+}
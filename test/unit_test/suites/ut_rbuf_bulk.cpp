@@ -0,0 +1,104 @@
+//! \file ut_rbuf_bulk.cpp
+//! \brief Ring Buffer large block copies unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_bulk.h"
+}
+
+using namespace testing;
+
+class RBUF_Bulk_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data.data(), DATA_SIZE);
+    BUF_InitFull(&buf_src, src_data.data(), BLOCK_SIZE);
+    BUF_InitEmpty(&buf_dst, dst_data.data(), BLOCK_SIZE);
+    for (size_t i = 0; i < BLOCK_SIZE; i++)
+    {
+      src_data[i] = (uint8_t) (i * 7U);
+    }
+  }
+  // attributes
+  static constexpr RBUF_size_t DATA_SIZE  = 50000;
+  static constexpr RBUF_size_t BLOCK_SIZE = 30001; /* Odd size exercises head and tail copies */
+
+  RBUF_t rbuf;
+  std::vector<uint8_t> data = std::vector<uint8_t>(DATA_SIZE);
+
+  BUF_t buf_src;
+  std::vector<uint8_t> src_data = std::vector<uint8_t>(BLOCK_SIZE);
+  BUF_t buf_dst;
+  std::vector<uint8_t> dst_data = std::vector<uint8_t>(BLOCK_SIZE);
+};
+
+/**
+ * \brief Copy with every misalignment and size around the kernel steps
+ */
+TEST_F(RBUF_Bulk_Fixture, bulk_001)
+{
+  for (size_t offset = 0; offset < 33; offset++)
+  {
+    for (size_t size : {0, 1, 63, 64, 127, 128, 129, 1000})
+    {
+      std::fill(dst_data.begin(), dst_data.end(), 0xEE);
+      RBUF_BulkCopy(&dst_data[offset], &src_data[3], size);
+      EXPECT_EQ(memcmp(&dst_data[offset], &src_data[3], size), 0);
+      EXPECT_EQ(dst_data[offset + size], 0xEE);
+    }
+  }
+}
+
+/**
+ * \brief Large write then read through a ring across rollover
+ */
+TEST_F(RBUF_Bulk_Fixture, bulk_002)
+{
+  /* Place indexes so the block crosses the end of ring data */
+  rbuf.write_index = 40000;
+  rbuf.read_index  = 40000;
+
+  EXPECT_TRUE(RBUF_BulkWriteCopy(&rbuf, &buf_src, BLOCK_SIZE));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), BLOCK_SIZE);
+  EXPECT_EQ(rbuf.write_index, (40000 + BLOCK_SIZE) % DATA_SIZE);
+  EXPECT_EQ(BUF_GetToReadCount(&buf_src), 0);
+
+  EXPECT_TRUE(RBUF_BulkReadCopyBlock(&buf_dst, &rbuf, BLOCK_SIZE));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+  EXPECT_EQ(dst_data, src_data);
+}
+
+/**
+ * \brief Small transfers take the regular path, same result
+ */
+TEST_F(RBUF_Bulk_Fixture, bulk_003)
+{
+  BUF_InitFull(&buf_src, src_data.data(), 100);
+  EXPECT_TRUE(RBUF_BulkWriteCopy(&rbuf, &buf_src, 100));
+  EXPECT_TRUE(RBUF_BulkReadCopyBlock(&buf_dst, &rbuf, 100));
+  EXPECT_EQ(memcmp(dst_data.data(), src_data.data(), 100), 0);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Bulk_Fixture, bulk_004)
+{
+  EXPECT_FALSE(RBUF_BulkWriteCopy(nullptr, &buf_src, BLOCK_SIZE));
+  EXPECT_FALSE(RBUF_BulkWriteCopy(&rbuf, nullptr, BLOCK_SIZE));
+  EXPECT_FALSE(RBUF_BulkReadCopyBlock(nullptr, &rbuf, BLOCK_SIZE));
+  EXPECT_FALSE(RBUF_BulkReadCopyBlock(&buf_dst, nullptr, BLOCK_SIZE));
+  EXPECT_FALSE(RBUF_BulkReadCopyBlock(&buf_dst, &rbuf, BLOCK_SIZE)); // Empty ring
+
+  /* Source buffer overlapping ring data */
+  BUF_InitFull(&buf_src, data.data(), 20000);
+  EXPECT_FALSE(RBUF_BulkWriteCopy(&rbuf, &buf_src, 20000));
+  RBUF_BulkCopy(nullptr, src_data.data(), 1);
+}
@@ -0,0 +1,171 @@
+//! \file ut_rbuf_coalesce.cpp
+//! \brief Ring Buffer coalescing writer unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_coalesce.h"
+#include "ring_buffer/ring_buffer_monitor.h"
+}
+
+using namespace testing;
+
+namespace
+{
+
+uint32_t FakeClock(void *context)
+{
+  return *static_cast<uint32_t *>(context);
+}
+
+} // namespace
+
+class RBUF_Coalesce_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, sizeof(data));
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+    ASSERT_TRUE(RBUF_MonitorAttach(&rbuf, &monitor));
+  }
+  // attributes
+  RBUF_t rbuf;
+  std::uint8_t data[16];
+  BUF_t buf;
+  std::uint8_t buf_data[64];
+  RBUF_Monitor_t monitor;
+  RBUF_Coalesce_t coalesce;
+  uint32_t now = 0xFFFFFFF0U; // Wraps during the tests
+};
+
+/**
+ * \brief Writes stay invisible until threshold, then are published at once
+ */
+TEST_F(RBUF_Coalesce_Fixture, coalesce_001)
+{
+  RBUF_CoalesceInit(&coalesce, &rbuf, 8, 100, FakeClock, &now);
+
+  EXPECT_TRUE(RBUF_CoalesceWriteUint8(&coalesce, 0x01));
+  EXPECT_TRUE(RBUF_CoalesceWriteUint16(&coalesce, 0x0203));
+  EXPECT_TRUE(RBUF_CoalesceWriteString(&coalesce, "\x04", 1));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 0);
+  EXPECT_EQ(RBUF_CoalesceGetStagedSize(&coalesce), 4);
+
+  EXPECT_TRUE(RBUF_CoalesceWriteUint32(&coalesce, 0x05060708));
+  EXPECT_EQ(RBUF_CoalesceGetStagedSize(&coalesce), 0);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 8);
+  EXPECT_EQ(monitor.write.count, 1U);
+  EXPECT_EQ(coalesce.writes, 4U);
+  EXPECT_EQ(coalesce.commits, 1U);
+
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 8));
+  for (uint8_t i = 0; i < 8; i++)
+  {
+    EXPECT_EQ(buf_data[i], i + 1);
+  }
+}
+
+/**
+ * \brief Delay publishes on poll and on the next write, clock wrapping
+ */
+TEST_F(RBUF_Coalesce_Fixture, coalesce_002)
+{
+  RBUF_CoalesceInit(&coalesce, &rbuf, 8, 20, FakeClock, &now);
+
+  EXPECT_FALSE(RBUF_CoalescePoll(&coalesce)); // Nothing staged
+  EXPECT_TRUE(RBUF_CoalesceWriteUint8(&coalesce, 'a'));
+  now += 19;
+  EXPECT_FALSE(RBUF_CoalescePoll(&coalesce));
+  now += 1;
+  EXPECT_TRUE(RBUF_CoalescePoll(&coalesce));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 1);
+
+  EXPECT_TRUE(RBUF_CoalesceWriteUint8(&coalesce, 'b'));
+  now += 25;
+  EXPECT_TRUE(RBUF_CoalesceWriteUint8(&coalesce, 'c')); // Late write publishes both
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 3);
+  EXPECT_EQ(coalesce.commits, 2U);
+
+  EXPECT_TRUE(RBUF_CoalesceWriteUint8(&coalesce, 'd'));
+  EXPECT_TRUE(RBUF_CoalesceFlush(&coalesce));
+  EXPECT_FALSE(RBUF_CoalesceFlush(&coalesce));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 4);
+}
+
+/**
+ * \brief Staging across rollover, full ring publishes staged bytes and rejects the write
+ */
+TEST_F(RBUF_Coalesce_Fixture, coalesce_003)
+{
+  RBUF_CoalesceInit(&coalesce, &rbuf, 64, 0, nullptr, nullptr);
+  rbuf.write_index = 12;
+  rbuf.read_index = 12;
+
+  EXPECT_TRUE(RBUF_CoalesceWriteString(&coalesce, "0123456789", 10));
+  EXPECT_TRUE(RBUF_CoalesceWriteString(&coalesce, "abcde", 5));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 0);
+  EXPECT_FALSE(RBUF_CoalesceWriteUint8(&coalesce, 'f'));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 15);
+  EXPECT_EQ(RBUF_CoalesceGetStagedSize(&coalesce), 0);
+
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 15));
+  EXPECT_EQ(0, memcmp(buf_data, "0123456789abcde", 15));
+}
+
+/**
+ * \brief Threshold 0 and delay 0 publish every write
+ */
+TEST_F(RBUF_Coalesce_Fixture, coalesce_004)
+{
+  RBUF_CoalesceInit(&coalesce, &rbuf, 0, 0, FakeClock, &now);
+  EXPECT_TRUE(RBUF_CoalesceWriteUint16(&coalesce, 0x0102));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 2);
+
+  RBUF_CoalesceInit(&coalesce, &rbuf, 8, 0, FakeClock, &now);
+  EXPECT_TRUE(RBUF_CoalesceWriteUint8(&coalesce, 0x03));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 3);
+  EXPECT_EQ(monitor.write.count, 2U);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Coalesce_Fixture, coalesce_005)
+{
+  RBUF_CoalesceInit(&coalesce, nullptr, 8, 0, nullptr, nullptr);
+  EXPECT_FALSE(RBUF_CoalesceWriteUint8(&coalesce, 0));
+  EXPECT_FALSE(RBUF_CoalesceFlush(&coalesce));
+  EXPECT_FALSE(RBUF_CoalescePoll(&coalesce));
+
+  RBUF_CoalesceInit(&coalesce, &rbuf, 8, 0, nullptr, nullptr);
+  EXPECT_FALSE(RBUF_CoalesceWriteString(&coalesce, nullptr, 1));
+  EXPECT_FALSE(RBUF_CoalesceWriteString(&coalesce, "0123456789abcdef", 16));
+  EXPECT_FALSE(RBUF_CoalesceWriteUint8(nullptr, 0));
+  EXPECT_FALSE(RBUF_CoalesceFlush(nullptr));
+  EXPECT_FALSE(RBUF_CoalescePoll(nullptr));
+  EXPECT_EQ(RBUF_CoalesceGetStagedSize(nullptr), 0);
+  RBUF_CoalesceInit(nullptr, &rbuf, 8, 0, nullptr, nullptr);
+}
+
+/**
+ * \brief Refused commit keeps bytes staged
+ */
+TEST_F(RBUF_Coalesce_Fixture, coalesce_006)
+{
+  RBUF_CoalesceInit(&coalesce, &rbuf, 8, 0, nullptr, nullptr);
+  EXPECT_TRUE(RBUF_CoalesceWriteUint16(&coalesce, 0x0102));
+
+  // Another writer takes the room behind the coalescer
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "0123456789abcd", 14));
+  EXPECT_FALSE(RBUF_CoalesceFlush(&coalesce));
+  EXPECT_EQ(RBUF_CoalesceGetStagedSize(&coalesce), 2U);
+  EXPECT_EQ(coalesce.commits, 0U);
+
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, 14));
+  EXPECT_TRUE(RBUF_CoalesceFlush(&coalesce));
+  EXPECT_EQ(RBUF_CoalesceGetStagedSize(&coalesce), 0U);
+  EXPECT_EQ(coalesce.commits, 1U);
+}
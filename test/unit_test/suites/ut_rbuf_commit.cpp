@@ -0,0 +1,109 @@
+//! \file ut_rbuf_commit.cpp
+//! \brief Ring rbuf write/read commit unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer.h"
+}
+
+using namespace testing;
+
+class RBUF_Commit_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+  }
+  // attributes
+  RBUF_t rbuf;
+  static constexpr uint8_t DATA_SIZE = 5;
+  std::uint8_t data[DATA_SIZE];
+};
+
+/**
+ * \brief Commit bytes stored in place, with rollover
+ */
+TEST_F(RBUF_Commit_Fixture, commit_001)
+{
+  rbuf.write_index = 3;
+  rbuf.read_index  = 3;
+  data[3]          = 0xAA;
+  data[4]          = 0xBB;
+  data[0]          = 0xCC;
+
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 3));
+  EXPECT_EQ(rbuf.write_index, 1);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 3);
+  EXPECT_EQ(RBUF_ReadUint8(&rbuf), 0xAA);
+
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, 2));
+  EXPECT_EQ(rbuf.read_index, 1);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief Commit more than available
+ */
+TEST_F(RBUF_Commit_Fixture, commit_002)
+{
+  EXPECT_FALSE(RBUF_WriteCommit(&rbuf, DATA_SIZE));
+  EXPECT_FALSE(RBUF_ReadCommit(&rbuf, 1));
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, DATA_SIZE - 1));
+  EXPECT_FALSE(RBUF_ReadCommit(&rbuf, DATA_SIZE));
+  EXPECT_EQ(rbuf.write_index, DATA_SIZE - 1);
+  EXPECT_EQ(rbuf.read_index, 0);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Commit_Fixture, commit_003)
+{
+  EXPECT_FALSE(RBUF_WriteCommit(nullptr, 0));
+  EXPECT_FALSE(RBUF_ReadCommit(nullptr, 0));
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 0));
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, 0));
+}
+
+/**
+ * \brief Reserve and peek spans, split on rollover, bad input parameters
+ */
+TEST_F(RBUF_Commit_Fixture, commit_004)
+{
+  RBUF_Span_t spans[2];
+
+  EXPECT_EQ(RBUF_WriteReserve(&rbuf, spans), DATA_SIZE - 1);
+  EXPECT_EQ(spans[0].data, &data[0]);
+  EXPECT_EQ(spans[0].size, DATA_SIZE - 1);
+  EXPECT_EQ(spans[1].size, 0);
+  EXPECT_EQ(RBUF_ReadPeek(&rbuf, spans), 0);
+
+  rbuf.write_index = 1;
+  rbuf.read_index  = 3;
+  EXPECT_EQ(RBUF_WriteReserve(&rbuf, spans), 1);
+  EXPECT_EQ(spans[0].data, &data[1]);
+  EXPECT_EQ(spans[0].size, 1);
+  EXPECT_EQ(spans[1].size, 0);
+
+  EXPECT_EQ(RBUF_ReadPeek(&rbuf, spans), 3);
+  EXPECT_EQ(spans[0].data, &data[3]);
+  EXPECT_EQ(spans[0].size, 2);
+  EXPECT_EQ(spans[1].data, &data[0]);
+  EXPECT_EQ(spans[1].size, 1);
+
+  rbuf.write_index = 3;
+  rbuf.read_index  = 1;
+  EXPECT_EQ(RBUF_WriteReserve(&rbuf, spans), 2);
+  EXPECT_EQ(spans[0].data, &data[3]);
+  EXPECT_EQ(spans[0].size, 2);
+  EXPECT_EQ(spans[1].size, 0);
+
+  EXPECT_EQ(RBUF_WriteReserve(nullptr, spans), 0);
+  EXPECT_EQ(RBUF_ReadPeek(nullptr, spans), 0);
+  EXPECT_EQ(RBUF_WriteReserve(&rbuf, nullptr), 0);
+  EXPECT_EQ(RBUF_ReadPeek(&rbuf, nullptr), 0);
+}
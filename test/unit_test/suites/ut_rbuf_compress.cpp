@@ -0,0 +1,176 @@
+//! \file ut_rbuf_compress.cpp
+//! \brief Ring Buffer compression unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gmock/gmock.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_compress.h"
+}
+
+using namespace testing;
+using testing::ElementsAreArray;
+
+class RBUF_Compress_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+    RBUF_CompressInit(&compress, &rbuf, block, BLOCK_SIZE, FRAME_SIZE);
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+
+  /**
+   * \brief Sensor frame: constant header, slowly moving counter and samples
+   */
+  std::vector<std::uint8_t> MakeFrames(int count)
+  {
+    std::vector<std::uint8_t> frames;
+    for (int i = 0; i < count; i++)
+    {
+      std::uint8_t frame[FRAME_SIZE] = {0xA5, 0x5A, 0x01, 0x10, (std::uint8_t) i, 0x00, 0x40, 0x12,
+                                        0x34, 0x00, 0x00, 0x7F, 0x80, 0x00, 0x00, 0xFF};
+      frame[9] = (std::uint8_t) (i / 4);
+      frames.insert(frames.end(), frame, frame + FRAME_SIZE);
+    }
+    return frames;
+  }
+  // attributes
+  static constexpr uint16_t DATA_SIZE  = 1024;
+  static constexpr uint16_t BLOCK_SIZE = 512;
+  static constexpr uint8_t FRAME_SIZE  = 16;
+
+  RBUF_t rbuf;
+  std::uint8_t data[DATA_SIZE];
+  RBUF_Compress_t compress;
+  std::uint8_t block[BLOCK_SIZE];
+
+  BUF_t buf;
+  std::uint8_t buf_data[2048];
+};
+
+/**
+ * \brief Round trip of repetitive frames, at least 3x smaller in the ring
+ */
+TEST_F(RBUF_Compress_Fixture, compress_001)
+{
+  auto frames = MakeFrames(100);
+
+  ASSERT_EQ(RBUF_CompressWrite(&compress, frames.data(), frames.size()), frames.size());
+  ASSERT_TRUE(RBUF_CompressFlush(&compress));
+  EXPECT_EQ(compress.raw_size, frames.size());
+  EXPECT_EQ(compress.compressed_size, RBUF_GetUsedSize(&rbuf));
+  EXPECT_GE(compress.raw_size, 3 * compress.compressed_size);
+
+  while (RBUF_DecompressRead(&buf, &rbuf, FRAME_SIZE) == true)
+  {}
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+  ASSERT_EQ(buf.write_index, frames.size());
+  EXPECT_THAT(frames, ElementsAreArray(buf.data, frames.size()));
+}
+
+/**
+ * \brief Incompressible data stays within bound, blocks wrap around the ring
+ */
+TEST_F(RBUF_Compress_Fixture, compress_002)
+{
+  std::vector<std::uint8_t> noise(BLOCK_SIZE);
+  std::uint32_t seed = 1;
+  for (auto &byte : noise)
+  {
+    seed  = seed * 1103515245U + 12345U;
+    byte = (std::uint8_t) (seed >> 16);
+  }
+
+  for (int round = 0; round < 10; round++)
+  {
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+    ASSERT_EQ(RBUF_CompressWrite(&compress, noise.data(), noise.size()), noise.size());
+    EXPECT_LE(RBUF_GetUsedSize(&rbuf), RBUF_COMPRESS_BOUND(BLOCK_SIZE));
+    ASSERT_TRUE(RBUF_DecompressRead(&buf, &rbuf, FRAME_SIZE));
+    EXPECT_THAT(noise, ElementsAreArray(buf.data, noise.size()));
+  }
+}
+
+/**
+ * \brief Partial block and ring without room
+ */
+TEST_F(RBUF_Compress_Fixture, compress_003)
+{
+  std::uint8_t small_data[64];
+  RBUF_InitEmpty(&rbuf, small_data, sizeof(small_data));
+
+  std::vector<std::uint8_t> bytes(BLOCK_SIZE + 1, 0x11);
+  EXPECT_EQ(RBUF_CompressWrite(&compress, bytes.data(), bytes.size()), BLOCK_SIZE);
+  EXPECT_EQ(compress.block_used, BLOCK_SIZE);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+  EXPECT_FALSE(RBUF_CompressFlush(&compress));
+
+  RBUF_CompressInit(&compress, &rbuf, block, BLOCK_SIZE, FRAME_SIZE);
+  EXPECT_EQ(RBUF_CompressWrite(&compress, bytes.data(), 10), 10);
+  EXPECT_FALSE(RBUF_DecompressRead(&buf, &rbuf, FRAME_SIZE));
+  EXPECT_TRUE(RBUF_CompressFlush(&compress));
+  EXPECT_TRUE(RBUF_CompressFlush(&compress));
+  EXPECT_TRUE(RBUF_DecompressRead(&buf, &rbuf, FRAME_SIZE));
+  EXPECT_EQ(buf.write_index, 10);
+}
+
+/**
+ * \brief Corrupted block is dropped
+ */
+TEST_F(RBUF_Compress_Fixture, compress_004)
+{
+  std::uint8_t corrupted[] = {0x00, 0x05, 0x00, 0x02, 0x7F, 0x00};
+  RBUF_WriteString(&rbuf, (const char *) corrupted, sizeof(corrupted));
+  EXPECT_FALSE(RBUF_DecompressRead(&buf, &rbuf, 1));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+  EXPECT_EQ(buf.write_index, 0);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Compress_Fixture, compress_005)
+{
+  std::uint8_t byte = 0;
+  EXPECT_EQ(RBUF_CompressWrite(nullptr, &byte, 1), 0);
+  EXPECT_EQ(RBUF_CompressWrite(&compress, nullptr, 1), 0);
+  EXPECT_FALSE(RBUF_CompressFlush(nullptr));
+  EXPECT_FALSE(RBUF_DecompressRead(nullptr, &rbuf, 1));
+  EXPECT_FALSE(RBUF_DecompressRead(&buf, nullptr, 1));
+
+  RBUF_CompressInit(&compress, &rbuf, block, RBUF_COMPRESS_BLOCK_MAX + 1, 1);
+  EXPECT_EQ(RBUF_CompressWrite(&compress, &byte, 1), 0);
+}
+
+/**
+ * \brief Impossible header sizes or block larger than destination are dropped, ring does not stall
+ */
+TEST_F(RBUF_Compress_Fixture, compress_006)
+{
+  std::uint8_t huge_encoded[] = {0x00, 0x05, 0x7F, 0xF0, 0x00};
+  RBUF_WriteString(&rbuf, (const char *) huge_encoded, sizeof(huge_encoded));
+  EXPECT_FALSE(RBUF_DecompressRead(&buf, &rbuf, 1));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+
+  std::uint8_t huge_raw[] = {0xFF, 0xFF, 0x00, 0x02, 0x80, 0x00};
+  RBUF_WriteString(&rbuf, (const char *) huge_raw, sizeof(huge_raw));
+  EXPECT_FALSE(RBUF_DecompressRead(&buf, &rbuf, 1));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+
+  std::vector<std::uint8_t> frames = MakeFrames(4);
+  BUF_t small;
+  std::uint8_t small_data[16];
+  BUF_InitEmpty(&small, small_data, sizeof(small_data));
+  EXPECT_EQ(RBUF_CompressWrite(&compress, frames.data(), (RBUF_size_t) frames.size()), frames.size());
+  EXPECT_TRUE(RBUF_CompressFlush(&compress));
+  EXPECT_FALSE(RBUF_DecompressRead(&small, &rbuf, FRAME_SIZE));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+
+  EXPECT_EQ(RBUF_CompressWrite(&compress, frames.data(), FRAME_SIZE), FRAME_SIZE);
+  EXPECT_TRUE(RBUF_CompressFlush(&compress));
+  EXPECT_TRUE(RBUF_DecompressRead(&small, &rbuf, FRAME_SIZE));
+  EXPECT_THAT(std::vector<std::uint8_t>(small_data, small_data + FRAME_SIZE), ElementsAreArray(frames.data(), FRAME_SIZE));
+}
@@ -0,0 +1,166 @@
+//! \file ut_rbuf_file.cpp
+//! \brief Ring Buffer file backed persistence unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gmock/gmock.h>
+
+#include <cstdio>
+#include <unistd.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_shm.h"
+}
+
+using namespace testing;
+using testing::ElementsAreArray;
+
+class RBUF_File_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    snprintf(path, sizeof(path), "/tmp/ut_rbuf_file_%d.bin", (int) getpid());
+    unlink(path);
+    BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+  }
+  void TearDown()
+  {
+    RBUF_ShmDetach(&ring);
+    unlink(path);
+  }
+  // attributes
+  static constexpr uint8_t DATA_SIZE = 10;
+
+  char path[64];
+  RBUF_Shm_t ring = {};
+  BUF_t buf;
+  std::uint8_t buf_data[DATA_SIZE] = {};
+};
+
+/**
+ * \brief Committed data survives close and reopen
+ */
+TEST_F(RBUF_File_Fixture, file_001)
+{
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  EXPECT_EQ(RBUF_ShmGetUsedSize(&ring), 0);
+  EXPECT_TRUE(RBUF_ShmWriteString(&ring, "Hello", 5));
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_SYNC));
+  RBUF_ShmDetach(&ring);
+
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  EXPECT_EQ(RBUF_ShmReadCopyRaw(&buf, &ring, DATA_SIZE), 5);
+  std::vector<std::uint8_t> expected = {'H', 'e', 'l', 'l', 'o'};
+  EXPECT_THAT(expected, ElementsAreArray(buf.data, 5));
+}
+
+/**
+ * \brief Reopen restores the last committed prefix, uncommitted writes and reads are dropped
+ */
+TEST_F(RBUF_File_Fixture, file_002)
+{
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  EXPECT_TRUE(RBUF_ShmWriteString(&ring, "abc", 3));
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_NONE));
+  EXPECT_TRUE(RBUF_ShmWriteString(&ring, "def", 3));
+  EXPECT_EQ(RBUF_ShmReadCopyRaw(&buf, &ring, 2), 2);
+  RBUF_ShmDetach(&ring); /* Crash: no RBUF_Sync */
+
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  EXPECT_EQ(RBUF_ShmGetUsedSize(&ring), 3);
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_ASYNC));
+}
+
+/**
+ * \brief Size mismatch or corrupted file re-creates an empty ring
+ */
+TEST_F(RBUF_File_Fixture, file_003)
+{
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  EXPECT_TRUE(RBUF_ShmWriteString(&ring, "abc", 3));
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_NONE));
+  RBUF_ShmDetach(&ring);
+
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE * 2));
+  EXPECT_EQ(RBUF_ShmGetUsedSize(&ring), 0);
+  EXPECT_EQ(RBUF_ShmGetFreeSize(&ring), DATA_SIZE * 2 - 1);
+  RBUF_ShmDetach(&ring);
+
+  FILE *file = fopen(path, "r+b");
+  ASSERT_NE(file, nullptr);
+  fputs("garbage", file);
+  fclose(file);
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  EXPECT_EQ(RBUF_ShmGetUsedSize(&ring), 0);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_File_Fixture, file_004)
+{
+  EXPECT_FALSE(RBUF_FileOpen(nullptr, path, DATA_SIZE));
+  EXPECT_FALSE(RBUF_FileOpen(&ring, nullptr, DATA_SIZE));
+  EXPECT_FALSE(RBUF_FileOpen(&ring, path, 0));
+  EXPECT_FALSE(RBUF_FileOpen(&ring, "/nonexistent/dir/file", DATA_SIZE));
+  EXPECT_FALSE(RBUF_Sync(nullptr, RBUF_SYNC_SYNC));
+  EXPECT_FALSE(RBUF_Sync(&ring, RBUF_SYNC_SYNC));
+}
+
+/**
+ * \brief Drained bytes are not overwritten before the next commit, reopen finds them intact
+ */
+TEST_F(RBUF_File_Fixture, file_005)
+{
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  EXPECT_TRUE(RBUF_ShmWriteString(&ring, "abcdefgh", 8));
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_SYNC));
+  EXPECT_EQ(RBUF_ShmReadCopyRaw(&buf, &ring, 8), 8);
+  EXPECT_EQ(RBUF_ShmGetUsedSize(&ring), 0);
+  EXPECT_EQ(RBUF_ShmGetFreeSize(&ring), 1);
+  EXPECT_FALSE(RBUF_ShmWriteString(&ring, "ijklmn", 6));
+  EXPECT_TRUE(RBUF_ShmWriteString(&ring, "i", 1));
+  RBUF_ShmDetach(&ring); /* Crash: no RBUF_Sync */
+
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+  EXPECT_EQ(RBUF_ShmReadCopyRaw(&buf, &ring, DATA_SIZE), 8);
+  std::vector<std::uint8_t> expected = {'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h'};
+  EXPECT_THAT(expected, ElementsAreArray(buf.data, 8));
+
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_ASYNC));
+  EXPECT_EQ(RBUF_ShmGetFreeSize(&ring), 1);
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_SYNC));
+  EXPECT_EQ(RBUF_ShmGetFreeSize(&ring), DATA_SIZE - 1);
+  EXPECT_TRUE(RBUF_ShmWriteString(&ring, "ijklmn", 6));
+}
+
+/**
+ * \brief Asynchronous syncs alone commit with one call of lag, the ring drains and refills
+ */
+TEST_F(RBUF_File_Fixture, file_006)
+{
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  for (int lap = 0; lap < 3; lap++)
+  {
+    BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+    EXPECT_TRUE(RBUF_ShmWriteString(&ring, "abcdefgh", 8));
+    EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_ASYNC));
+    EXPECT_EQ(RBUF_ShmReadCopyRaw(&buf, &ring, 8), 8U);
+    EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_ASYNC)); // Commits the write
+    EXPECT_EQ(RBUF_ShmGetFreeSize(&ring), 1U);
+    EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_ASYNC)); // Commits the drain
+    EXPECT_EQ(RBUF_ShmGetFreeSize(&ring), DATA_SIZE - 1U);
+  }
+
+  EXPECT_TRUE(RBUF_ShmWriteString(&ring, "ijk", 3));
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_ASYNC));
+  EXPECT_TRUE(RBUF_Sync(&ring, RBUF_SYNC_ASYNC));
+  RBUF_ShmDetach(&ring); /* Crash after the commit */
+
+  ASSERT_TRUE(RBUF_FileOpen(&ring, path, DATA_SIZE));
+  BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+  EXPECT_EQ(RBUF_ShmReadCopyRaw(&buf, &ring, DATA_SIZE), 3U);
+  EXPECT_EQ(memcmp(buf_data, "ijk", 3), 0);
+}
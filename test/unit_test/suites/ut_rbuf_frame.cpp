@@ -0,0 +1,246 @@
+//! \file ut_rbuf_frame.cpp
+//! \brief Ring Buffer COBS and SLIP framing unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gmock/gmock.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_frame.h"
+}
+
+using namespace testing;
+using testing::ElementsAreArray;
+
+class RBUF_Frame_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+
+  /**
+   * \brief Move empty ring indices close to the end so the next frame wraps
+   */
+  void MoveToEnd(RBUF_size_t offset)
+  {
+    rbuf.write_index = DATA_SIZE - offset;
+    rbuf.read_index  = DATA_SIZE - offset;
+  }
+
+  std::vector<std::uint8_t> Decoded()
+  {
+    return std::vector<std::uint8_t>(buf_data, buf_data + buf.write_index);
+  }
+  // attributes
+  static constexpr uint16_t DATA_SIZE = 512;
+
+  RBUF_t rbuf;
+  std::uint8_t data[DATA_SIZE];
+
+  BUF_t buf;
+  std::uint8_t buf_data[400];
+};
+
+/**
+ * \brief COBS encoding of a known frame, round trip across rollover
+ */
+TEST_F(RBUF_Frame_Fixture, frame_001)
+{
+  std::uint8_t frame[]   = {0x11, 0x22, 0x00, 0x33};
+  std::uint8_t encoded[] = {0x03, 0x11, 0x22, 0x02, 0x33, 0x00};
+
+  EXPECT_TRUE(RBUF_CobsEncode(&rbuf, frame, sizeof(frame)));
+  EXPECT_THAT(std::vector<std::uint8_t>(data, data + sizeof(encoded)), ElementsAreArray(encoded));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAreArray(frame));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+
+  std::vector<std::uint8_t> zeros = {0x00, 0x00, 0x01, 0x00};
+  MoveToEnd(3);
+  BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  EXPECT_TRUE(RBUF_CobsEncode(&rbuf, zeros.data(), (RBUF_size_t) zeros.size()));
+  EXPECT_TRUE(RBUF_CobsEncode(&rbuf, nullptr, 0));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAreArray(zeros));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_EQ(buf.write_index, zeros.size());
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief COBS frame longer than a block, with and without zeros, across rollover
+ */
+TEST_F(RBUF_Frame_Fixture, frame_002)
+{
+  std::vector<std::uint8_t> frame(300);
+  for (std::size_t i = 0; i < frame.size(); i++)
+  {
+    frame[i] = (std::uint8_t) (i + 1);
+  }
+
+  MoveToEnd(100);
+  EXPECT_TRUE(RBUF_CobsEncode(&rbuf, frame.data(), 254));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 256);
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAreArray(frame.data(), 254));
+
+  BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  EXPECT_TRUE(RBUF_CobsEncode(&rbuf, frame.data(), (RBUF_size_t) frame.size()));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), RBUF_COBS_BOUND(frame.size()));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAreArray(frame));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief SLIP encoding of a known frame, round trip across rollover
+ */
+TEST_F(RBUF_Frame_Fixture, frame_003)
+{
+  std::uint8_t frame[]   = {0x01, 0xC0, 0x02, 0xDB, 0xDB};
+  std::uint8_t encoded[] = {0x01, 0xDB, 0xDC, 0x02, 0xDB, 0xDD, 0xDB, 0xDD, 0xC0};
+
+  EXPECT_TRUE(RBUF_SlipEncode(&rbuf, frame, sizeof(frame)));
+  EXPECT_THAT(std::vector<std::uint8_t>(data, data + sizeof(encoded)), ElementsAreArray(encoded));
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAreArray(frame));
+
+  MoveToEnd(4);
+  BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  EXPECT_TRUE(RBUF_SlipEncode(&rbuf, frame, sizeof(frame)));
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAreArray(frame));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief Incomplete frame is left in the ring, leading delimiters are skipped
+ */
+TEST_F(RBUF_Frame_Fixture, frame_004)
+{
+  std::uint8_t cobs[] = {0x00, 0x00, 0x03, 0x11};
+  RBUF_WriteString(&rbuf, (const char *) cobs, sizeof(cobs));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_INCOMPLETE);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 2);
+
+  RBUF_WriteUint8(&rbuf, 0x22);
+  RBUF_WriteUint8(&rbuf, 0x00);
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAre(0x11, 0x22));
+
+  std::uint8_t slip[] = {0xC0, 0x01, 0xDB};
+  RBUF_WriteString(&rbuf, (const char *) slip, sizeof(slip));
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_INCOMPLETE);
+  RBUF_WriteUint8(&rbuf, 0xDC);
+  RBUF_WriteUint8(&rbuf, 0xC0);
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAre(0x11, 0x22, 0x01, 0xC0));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief Corrupted frame is dropped, next frame decodes
+ */
+TEST_F(RBUF_Frame_Fixture, frame_005)
+{
+  std::uint8_t cobs[] = {0x05, 0x11, 0x00, 0x02, 0x22, 0x00};
+  RBUF_WriteString(&rbuf, (const char *) cobs, sizeof(cobs));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_CORRUPTED);
+  EXPECT_EQ(buf.write_index, 0);
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAre(0x22));
+
+  std::uint8_t slip[] = {0x01, 0xDB, 0x01, 0xC0, 0x33, 0xDB, 0xC0, 0x44, 0xC0};
+  RBUF_WriteString(&rbuf, (const char *) slip, sizeof(slip));
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_CORRUPTED);
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_CORRUPTED);
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAre(0x22, 0x44));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief Frame larger than destination free space is dropped
+ */
+TEST_F(RBUF_Frame_Fixture, frame_006)
+{
+  std::uint8_t frame[] = {0x01, 0x00, 0x02, 0x03};
+
+  BUF_InitEmpty(&buf, buf_data, 3);
+  EXPECT_TRUE(RBUF_CobsEncode(&rbuf, frame, sizeof(frame)));
+  EXPECT_TRUE(RBUF_CobsEncode(&rbuf, frame, 3));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_OVERSIZE);
+  EXPECT_EQ(buf.write_index, 0);
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAre(0x01, 0x00, 0x02));
+
+  BUF_InitEmpty(&buf, buf_data, 3);
+  EXPECT_TRUE(RBUF_SlipEncode(&rbuf, frame, sizeof(frame)));
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_OVERSIZE);
+  EXPECT_EQ(buf.write_index, 0);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief Encoding needs room for the worst case frame
+ */
+TEST_F(RBUF_Frame_Fixture, frame_007)
+{
+  std::vector<std::uint8_t> frame(300, 0x01);
+
+  EXPECT_FALSE(RBUF_SlipEncode(&rbuf, frame.data(), (RBUF_size_t) frame.size()));
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+
+  rbuf.write_index = DATA_SIZE - 1 - RBUF_COBS_BOUND(frame.size());
+  EXPECT_TRUE(RBUF_CobsEncode(&rbuf, frame.data(), (RBUF_size_t) frame.size()));
+  EXPECT_FALSE(RBUF_CobsEncode(&rbuf, frame.data(), 1));
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Frame_Fixture, frame_008)
+{
+  std::uint8_t byte = 0;
+
+  EXPECT_FALSE(RBUF_CobsEncode(nullptr, &byte, 1));
+  EXPECT_FALSE(RBUF_CobsEncode(&rbuf, nullptr, 1));
+  EXPECT_FALSE(RBUF_SlipEncode(nullptr, &byte, 1));
+  EXPECT_FALSE(RBUF_SlipEncode(&rbuf, nullptr, 1));
+
+  RBUF_WriteUint8(&rbuf, 0x00);
+  EXPECT_EQ(RBUF_CobsDecode(nullptr, &rbuf), RBUF_FRAME_INCOMPLETE);
+  EXPECT_EQ(RBUF_CobsDecode(&buf, nullptr), RBUF_FRAME_INCOMPLETE);
+  EXPECT_EQ(RBUF_SlipDecode(nullptr, &rbuf), RBUF_FRAME_INCOMPLETE);
+  EXPECT_EQ(RBUF_SlipDecode(&buf, nullptr), RBUF_FRAME_INCOMPLETE);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 1);
+}
+
+/**
+ * \brief Full ring without delimiter is dropped, stream resumes at next frame
+ */
+TEST_F(RBUF_Frame_Fixture, frame_009)
+{
+  while (RBUF_WriteUint8(&rbuf, 0x11) == true)
+  {
+  }
+  EXPECT_TRUE(RBUF_IsFull(&rbuf));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_OVERSIZE);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+  EXPECT_EQ(buf.write_index, 0);
+
+  std::uint8_t cobs[] = {0x11, 0x00, 0x03, 0x11, 0x22, 0x00};
+  RBUF_WriteString(&rbuf, (const char *) cobs, sizeof(cobs));
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_CORRUPTED); /* Tail of the dropped frame */
+  EXPECT_EQ(RBUF_CobsDecode(&buf, &rbuf), RBUF_FRAME_DECODED);
+  EXPECT_THAT(Decoded(), ElementsAre(0x11, 0x22));
+
+  while (RBUF_WriteUint8(&rbuf, 0xC0 + 1U) == true)
+  {
+  }
+  EXPECT_EQ(RBUF_SlipDecode(&buf, &rbuf), RBUF_FRAME_OVERSIZE);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
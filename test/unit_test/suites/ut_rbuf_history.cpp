@@ -0,0 +1,108 @@
+//! \file ut_rbuf_history.cpp
+//! \brief Sample history ring and FIR kernels unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_history.h"
+}
+
+using namespace testing;
+
+class RBUF_History_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_HistoryInit(&history, data, CAPACITY);
+  }
+  // attributes
+  static constexpr uint8_t CAPACITY = 16;
+
+  RBUF_History_t history;
+  float data[RBUF_HISTORY_STORAGE_SIZE(CAPACITY)];
+};
+
+/**
+ * \brief Newest window is contiguous across rollover
+ */
+TEST_F(RBUF_History_Fixture, history_001)
+{
+  EXPECT_EQ(RBUF_HistoryGetWindow(&history, 1), nullptr);
+  for (int i = 0; i < 21; i++)
+  {
+    EXPECT_TRUE(RBUF_HistoryPush(&history, (float) i));
+  }
+
+  const float *window = RBUF_HistoryGetWindow(&history, CAPACITY);
+  ASSERT_NE(window, nullptr);
+  for (int i = 0; i < CAPACITY; i++)
+  {
+    EXPECT_EQ(window[i], (float) (5 + i));
+  }
+
+  window = RBUF_HistoryGetWindow(&history, 3);
+  ASSERT_NE(window, nullptr);
+  EXPECT_EQ(window[0], 18.0F);
+  EXPECT_EQ(window[2], 20.0F);
+  EXPECT_EQ(RBUF_HistoryGetWindow(&history, CAPACITY + 1), nullptr);
+}
+
+/**
+ * \brief FIR matches scalar reference for every tap count
+ */
+TEST_F(RBUF_History_Fixture, history_002)
+{
+  float taps[CAPACITY];
+  float output = 0.0F;
+
+  for (int i = 0; i < CAPACITY; i++)
+  {
+    taps[i] = 0.25F * (float) (i + 1);
+  }
+  for (int i = 0; i < 37; i++)
+  {
+    EXPECT_TRUE(RBUF_HistoryPush(&history, (float) ((i * 7) % 11) - 5.0F));
+
+    for (RBUF_size_t tap_count = 1; tap_count <= CAPACITY; tap_count++)
+    {
+      const float *window = RBUF_HistoryGetWindow(&history, tap_count);
+      if (window == nullptr)
+      {
+        EXPECT_FALSE(RBUF_HistoryFir(&history, taps, tap_count, &output));
+      }
+      else
+      {
+        double reference = 0.0;
+        for (RBUF_size_t k = 0; k < tap_count; k++)
+        {
+          reference += (double) window[k] * taps[k];
+        }
+        EXPECT_TRUE(RBUF_HistoryFir(&history, taps, tap_count, &output));
+        EXPECT_NEAR(output, reference, 1e-3);
+      }
+    }
+  }
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_History_Fixture, history_003)
+{
+  float taps[1] = {1.0F};
+  float output = 0.0F;
+
+  EXPECT_FALSE(RBUF_HistoryPush(nullptr, 1.0F));
+  EXPECT_EQ(RBUF_HistoryGetWindow(nullptr, 1), nullptr);
+  EXPECT_TRUE(RBUF_HistoryPush(&history, 1.0F));
+  EXPECT_EQ(RBUF_HistoryGetWindow(&history, 0), nullptr);
+  EXPECT_FALSE(RBUF_HistoryFir(&history, nullptr, 1, &output));
+  EXPECT_FALSE(RBUF_HistoryFir(&history, taps, 1, nullptr));
+  EXPECT_EQ(RBUF_HistoryDot(nullptr, taps, 1), 0.0F);
+
+  RBUF_HistoryInit(&history, nullptr, CAPACITY);
+  EXPECT_FALSE(RBUF_HistoryPush(&history, 1.0F));
+}
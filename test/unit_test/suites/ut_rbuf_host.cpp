@@ -0,0 +1,81 @@
+//! \file ut_rbuf_host.cpp
+//! \brief Ring Buffer huge page and NUMA storage unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_host.h"
+}
+
+using namespace testing;
+
+class RBUF_Host_Fixture : public ::testing::Test
+{
+protected:
+  void TearDown()
+  {
+    RBUF_HostFree(&mem);
+  }
+  // attributes
+  RBUF_HostMem_t mem = {};
+  RBUF_t rbuf;
+};
+
+/**
+ * \brief Regular pages, no binding
+ */
+TEST_F(RBUF_Host_Fixture, host_001)
+{
+  ASSERT_TRUE(RBUF_HostAlloc(&mem, 10000, RBUF_HOST_PAGES_DEFAULT, RBUF_HOST_NODE_NONE));
+  EXPECT_NE(mem.base, nullptr);
+  EXPECT_GE(mem.map_size, 10000U);
+  EXPECT_EQ(mem.pages, RBUF_HOST_PAGES_DEFAULT);
+  EXPECT_EQ(mem.node, RBUF_HOST_NODE_NONE);
+}
+
+/**
+ * \brief Huge pages requested, falls back when none are reserved, ring usable
+ */
+TEST_F(RBUF_Host_Fixture, host_002)
+{
+  ASSERT_TRUE(RBUF_HostCreate(&rbuf, &mem, 60000, RBUF_HOST_PAGES_HUGE, RBUF_HOST_NODE_CURRENT));
+  EXPECT_EQ(mem.map_size % RBUF_HOST_HUGE_PAGE_SIZE, 0U);
+  if (mem.pages != RBUF_HOST_PAGES_DEFAULT)
+  {
+    EXPECT_EQ((uintptr_t) mem.base % RBUF_HOST_HUGE_PAGE_SIZE, 0U);
+  }
+  if (mem.node != RBUF_HOST_NODE_NONE)
+  {
+    EXPECT_EQ(mem.node, RBUF_HostGetCurrentNode());
+  }
+
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "abc", 3));
+  EXPECT_EQ(RBUF_ReadUint8(&rbuf), 'a');
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 2);
+}
+
+/**
+ * \brief Transparent huge pages on an aligned range
+ */
+TEST_F(RBUF_Host_Fixture, host_003)
+{
+  ASSERT_TRUE(RBUF_HostAlloc(&mem, RBUF_HOST_HUGE_PAGE_SIZE + 1U, RBUF_HOST_PAGES_THP, 0));
+  EXPECT_EQ(mem.map_size, 2U * RBUF_HOST_HUGE_PAGE_SIZE);
+  EXPECT_EQ((uintptr_t) mem.base % RBUF_HOST_HUGE_PAGE_SIZE, 0U);
+  EXPECT_NE(mem.pages, RBUF_HOST_PAGES_HUGE);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Host_Fixture, host_004)
+{
+  EXPECT_FALSE(RBUF_HostAlloc(nullptr, 100, RBUF_HOST_PAGES_DEFAULT, RBUF_HOST_NODE_NONE));
+  EXPECT_FALSE(RBUF_HostAlloc(&mem, 0, RBUF_HOST_PAGES_DEFAULT, RBUF_HOST_NODE_NONE));
+  EXPECT_FALSE(RBUF_HostCreate(nullptr, &mem, 100, RBUF_HOST_PAGES_DEFAULT, RBUF_HOST_NODE_NONE));
+  ASSERT_TRUE(RBUF_HostAlloc(&mem, 100, RBUF_HOST_PAGES_DEFAULT, 4096));
+  EXPECT_EQ(mem.node, RBUF_HOST_NODE_NONE);
+  RBUF_HostFree(nullptr);
+}
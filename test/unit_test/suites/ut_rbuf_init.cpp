@@ -32,4 +32,8 @@ TEST_F(RBUF_Init_Fixture, init_001)
   EXPECT_EQ(rbuf.size, DATA_SIZE);
   EXPECT_EQ(rbuf.write_index, 0);
   EXPECT_EQ(rbuf.read_index, 0);
+  EXPECT_EQ(rbuf.ready_word, nullptr);
+  EXPECT_EQ(rbuf.hooks, 0U);
+  EXPECT_EQ(rbuf.watermark, nullptr);
+  EXPECT_EQ(rbuf.monitor, nullptr);
 }
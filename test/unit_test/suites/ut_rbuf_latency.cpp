@@ -0,0 +1,169 @@
+//! \file ut_rbuf_latency.cpp
+//! \brief Ring Buffer residency latency measurement unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_latency.h"
+}
+
+using namespace testing;
+
+namespace
+{
+
+uint32_t FakeClock(void *context)
+{
+  return *static_cast<uint32_t *>(context);
+}
+
+} // namespace
+
+class RBUF_Latency_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, sizeof(data));
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+  // attributes
+  RBUF_t rbuf;
+  std::uint8_t data[64];
+  BUF_t buf;
+  std::uint8_t buf_data[64];
+
+  RBUF_Latency_t latency;
+  RBUF_LatencySample_t samples[8];
+  uint32_t now = 1000;
+};
+
+/**
+ * \brief One sample per write, residency recorded when its first byte is consumed
+ */
+TEST_F(RBUF_Latency_Fixture, latency_001)
+{
+  RBUF_LatencyInit(&latency, samples, 8, RBUF_LATENCY_PER_WRITE, FakeClock, &now);
+  ASSERT_TRUE(RBUF_LatencyAttach(&rbuf, &latency));
+
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "abcd", 4));
+  now += 5;
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "ef", 2));
+  EXPECT_EQ(latency.sample_count, 2);
+
+  now += 10;
+  (void) RBUF_ReadUint8(&rbuf); // First record starts being consumed
+  EXPECT_EQ(latency.count, 1U);
+  EXPECT_EQ(latency.max, 15U);
+  now += 10;
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 4));
+  EXPECT_EQ(latency.count, 2U);
+  EXPECT_EQ(latency.max, 20U);
+  EXPECT_EQ(latency.sample_count, 0);
+}
+
+/**
+ * \brief Sampling per N bytes, at most one sample per write, FIFO overflow counted
+ */
+TEST_F(RBUF_Latency_Fixture, latency_002)
+{
+  RBUF_LatencyInit(&latency, samples, 2, 10, FakeClock, &now);
+  ASSERT_TRUE(RBUF_LatencyAttach(&rbuf, &latency));
+
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 25)); // Sample at byte 0, next at 30
+  EXPECT_EQ(latency.sample_count, 1);
+  EXPECT_EQ(latency.next_sample, 30U);
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 4)); // Bytes 25 to 28, no boundary
+  EXPECT_EQ(latency.sample_count, 1);
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 2)); // Byte 30
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 20)); // FIFO full
+  EXPECT_EQ(latency.sample_count, 2);
+  EXPECT_EQ(latency.dropped, 1U);
+
+  now += 100;
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, 30)); // Byte 30 not consumed yet
+  EXPECT_EQ(latency.count, 1U);
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, 21));
+  EXPECT_EQ(latency.count, 2U);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief Quantiles from the log-linear histogram, within bucket precision
+ */
+TEST_F(RBUF_Latency_Fixture, latency_003)
+{
+  RBUF_LatencySummary_t summary;
+  RBUF_LatencyInit(&latency, samples, 8, RBUF_LATENCY_PER_WRITE, FakeClock, &now);
+  ASSERT_TRUE(RBUF_LatencyAttach(&rbuf, &latency));
+
+  for (uint32_t residency = 1; residency <= 1000; residency++)
+  {
+    EXPECT_TRUE(RBUF_WriteUint8(&rbuf, 0));
+    now += residency;
+    (void) RBUF_ReadUint8(&rbuf);
+  }
+  RBUF_LatencyGetSummary(&latency, &summary);
+  EXPECT_EQ(summary.count, 1000U);
+  EXPECT_EQ(summary.max, 1000U);
+  EXPECT_NEAR(summary.p50, 500, 500 / 8);
+  EXPECT_NEAR(summary.p99, 990, 990 / 8);
+  EXPECT_EQ(RBUF_LatencyGetQuantile(&latency, 1000), 1000U);
+  EXPECT_LE(RBUF_LatencyGetQuantile(&latency, 0), 1U);
+
+  /* Small values are exact */
+  RBUF_LatencyReset(&latency);
+  EXPECT_EQ(RBUF_LatencyGetQuantile(&latency, 500), 0U);
+  EXPECT_TRUE(RBUF_WriteUint8(&rbuf, 0));
+  now += 3;
+  (void) RBUF_ReadUint8(&rbuf);
+  EXPECT_EQ(RBUF_LatencyGetQuantile(&latency, 500), 3U);
+
+  /* Largest residency lands in the last bucket */
+  RBUF_LatencyReset(&latency);
+  EXPECT_TRUE(RBUF_WriteUint8(&rbuf, 0));
+  now += 0xFFFFFFFFU;
+  (void) RBUF_ReadUint8(&rbuf);
+  EXPECT_EQ(latency.buckets[RBUF_LATENCY_BUCKET_COUNT - 1], 1U);
+  EXPECT_EQ(RBUF_LatencyGetQuantile(&latency, 500), 0xFFFFFFFFU);
+}
+
+/**
+ * \brief Data written before attach is not sampled, detach stops measuring
+ */
+TEST_F(RBUF_Latency_Fixture, latency_004)
+{
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "old", 3));
+  RBUF_LatencyInit(&latency, samples, 8, RBUF_LATENCY_PER_WRITE, FakeClock, &now);
+  ASSERT_TRUE(RBUF_LatencyAttach(&rbuf, &latency));
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "new", 3));
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 3));
+  EXPECT_EQ(latency.count, 0U);
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 1));
+  EXPECT_EQ(latency.count, 1U);
+
+  RBUF_LatencyDetach(&rbuf);
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "x", 1));
+  EXPECT_EQ(latency.sample_count, 0);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Latency_Fixture, latency_005)
+{
+  RBUF_LatencySummary_t summary = {};
+  RBUF_LatencyInit(&latency, nullptr, 8, 1, FakeClock, &now);
+  EXPECT_FALSE(RBUF_LatencyAttach(&rbuf, &latency));
+  RBUF_LatencyInit(&latency, samples, 8, 1, nullptr, &now);
+  EXPECT_FALSE(RBUF_LatencyAttach(&rbuf, &latency));
+  EXPECT_FALSE(RBUF_LatencyAttach(nullptr, &latency));
+  EXPECT_FALSE(RBUF_LatencyAttach(&rbuf, nullptr));
+  EXPECT_EQ(RBUF_LatencyGetQuantile(nullptr, 500), 0U);
+  RBUF_LatencyGetSummary(nullptr, &summary);
+  RBUF_LatencyGetSummary(&latency, nullptr);
+  RBUF_LatencyDetach(nullptr);
+  RBUF_LatencyInit(nullptr, samples, 8, 1, FakeClock, &now);
+}
@@ -0,0 +1,91 @@
+//! \file ut_rbuf_linearize.cpp
+//! \brief Ring rbuf linearize unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_monitor.h"
+}
+
+using namespace testing;
+
+class RBUF_Linearize_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+  // attributes
+  RBUF_t rbuf;
+  static constexpr uint8_t DATA_SIZE = 7;
+  std::uint8_t data[DATA_SIZE];
+  BUF_t buf;
+  std::uint8_t buf_data[DATA_SIZE];
+};
+
+/**
+ * \brief Wrapped data is rotated to the start, every read offset
+ */
+TEST_F(RBUF_Linearize_Fixture, linearize_001)
+{
+  for (RBUF_size_t start = 0; start < DATA_SIZE; start++)
+  {
+    for (RBUF_size_t used = 0; used < DATA_SIZE; used++)
+    {
+      rbuf.read_index = start;
+      rbuf.write_index = start;
+      for (RBUF_size_t i = 0; i < used; i++)
+      {
+        ASSERT_TRUE(RBUF_WriteUint8(&rbuf, (uint8_t) ('a' + i)));
+      }
+      ASSERT_TRUE(RBUF_Linearize(&rbuf));
+      EXPECT_EQ(rbuf.read_index, 0);
+      EXPECT_EQ(rbuf.write_index, used);
+      for (RBUF_size_t i = 0; i < used; i++)
+      {
+        EXPECT_EQ(data[i], 'a' + i) << "start " << start << " used " << used;
+      }
+      (void) RBUF_ReadCommit(&rbuf, used);
+    }
+  }
+}
+
+/**
+ * \brief Linearized buffer keeps working, monitor follows the new indexes
+ */
+TEST_F(RBUF_Linearize_Fixture, linearize_002)
+{
+  RBUF_Monitor_t monitor;
+  RBUF_Snapshot_t snapshot;
+
+  rbuf.read_index = 5;
+  rbuf.write_index = 5;
+  ASSERT_TRUE(RBUF_MonitorAttach(&rbuf, &monitor));
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "abcd", 4));
+  ASSERT_TRUE(RBUF_Linearize(&rbuf));
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "ef", 2));
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 6));
+  EXPECT_EQ(0, memcmp(buf_data, "abcdef", 6));
+
+  ASSERT_TRUE(RBUF_MonitorSnapshot(&monitor, &snapshot, 0));
+  EXPECT_EQ(snapshot.written, 6U);
+  EXPECT_EQ(snapshot.read, 6U);
+  EXPECT_EQ(snapshot.read_index, 6);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Linearize_Fixture, linearize_003)
+{
+  RBUF_t empty;
+  RBUF_InitEmpty(&empty, nullptr, 0);
+
+  EXPECT_FALSE(RBUF_Linearize(nullptr));
+  EXPECT_FALSE(RBUF_Linearize(&empty));
+}
@@ -0,0 +1,232 @@
+//! \file ut_rbuf_lock.cpp
+//! \brief Ring Buffer concurrency policy unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_lock.h"
+}
+
+using namespace testing;
+
+namespace
+{
+
+struct Hooks
+{
+  int depth = 0;
+  int enter_count = 0;
+};
+
+void HookEnter(void *context)
+{
+  Hooks *hooks = static_cast<Hooks *>(context);
+  EXPECT_EQ(hooks->depth, 0);
+  hooks->depth++;
+  hooks->enter_count++;
+}
+
+void HookExit(void *context)
+{
+  static_cast<Hooks *>(context)->depth--;
+}
+
+} // namespace
+
+class RBUF_Lock_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+  // attributes
+  RBUF_Locked_t locked;
+  std::uint8_t data[64];
+
+  BUF_t buf;
+  std::uint8_t buf_data[64];
+};
+
+/**
+ * \brief Without lock, behaves as the plain ring
+ */
+TEST_F(RBUF_Lock_Fixture, lock_001)
+{
+  RBUF_LockedInit(&locked, data, sizeof(data), nullptr);
+  EXPECT_TRUE(RBUF_LockedWriteString(&locked, "abc", 3));
+  EXPECT_EQ(RBUF_LockedGetUsedSize(&locked), 3);
+  EXPECT_EQ(RBUF_LockedGetFreeSize(&locked), sizeof(data) - 4);
+  EXPECT_EQ(RBUF_LockedReadCopyRaw(&buf, &locked, 8), 3);
+  EXPECT_EQ(memcmp(buf_data, "abc", 3), 0);
+  EXPECT_EQ(RBUF_LockedReadCopyRaw(&buf, &locked, 8), 0);
+}
+
+/**
+ * \brief Hooks wrap index snapshot and publish only, never nested
+ */
+TEST_F(RBUF_Lock_Fixture, lock_002)
+{
+  Hooks hooks;
+  RBUF_Lock_t lock;
+
+  RBUF_LockInitHooks(&lock, HookEnter, HookExit, &hooks);
+  RBUF_LockedInit(&locked, data, sizeof(data), &lock);
+
+  EXPECT_TRUE(RBUF_LockedWriteString(&locked, "abcdef", 6));
+  EXPECT_EQ(hooks.enter_count, 2); // Snapshot then publish
+  EXPECT_FALSE(RBUF_LockedWriteString(&locked, nullptr, 6));
+  EXPECT_EQ(hooks.enter_count, 3); // Nothing to publish
+  EXPECT_EQ(RBUF_LockedReadCopyRaw(&buf, &locked, 6), 6);
+  EXPECT_EQ(hooks.enter_count, 5);
+  EXPECT_EQ(hooks.depth, 0);
+}
+
+/**
+ * \brief Spinlock policy, writer and reader threads transfer a byte sequence
+ */
+TEST_F(RBUF_Lock_Fixture, lock_003)
+{
+  RBUF_Spinlock_t spinlock;
+  RBUF_Lock_t lock;
+  constexpr int TOTAL = 20000;
+
+  RBUF_LockInitSpin(&lock, &spinlock);
+  RBUF_LockedInit(&locked, data, sizeof(data), &lock);
+
+  std::thread writer([this]() {
+    int sent = 0;
+    while (sent < TOTAL)
+    {
+      char chunk[5];
+      int count = std::min(TOTAL - sent, (int) sizeof(chunk));
+      for (int i = 0; i < count; i++)
+      {
+        chunk[i] = (char) (sent + i);
+      }
+      if (RBUF_LockedWriteString(&locked, chunk, (RBUF_size_t) count) == true)
+      {
+        sent += count;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int received = 0;
+  bool in_order = true;
+  while (received < TOTAL)
+  {
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+    RBUF_size_t read = RBUF_LockedReadCopyRaw(&buf, &locked, 7);
+    for (RBUF_size_t i = 0; i < read; i++)
+    {
+      in_order &= (buf_data[i] == (uint8_t) (received + i));
+    }
+    received += read;
+    if (read == 0U)
+    {
+      std::this_thread::yield();
+    }
+  }
+  writer.join();
+  EXPECT_TRUE(in_order);
+  EXPECT_EQ(RBUF_LockedGetUsedSize(&locked), 0);
+  EXPECT_EQ(spinlock.flag, 0U);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Lock_Fixture, lock_004)
+{
+  RBUF_LockedInit(&locked, data, sizeof(data), nullptr);
+  EXPECT_FALSE(RBUF_LockedWriteString(nullptr, "a", 1));
+  EXPECT_EQ(RBUF_LockedReadCopyRaw(&buf, nullptr, 1), 0);
+  EXPECT_EQ(RBUF_LockedReadCopyRaw(nullptr, &locked, 1), 0);
+  EXPECT_EQ(RBUF_LockedGetUsedSize(nullptr), 0);
+  EXPECT_EQ(RBUF_LockedGetFreeSize(nullptr), 0);
+
+  RBUF_Lock_t lock;
+  RBUF_LockInitSpin(&lock, nullptr);
+  RBUF_LockInitNone(nullptr);
+}
+
+/**
+ * \brief Integer, block and in place accesses publish through the lock
+ */
+TEST_F(RBUF_Lock_Fixture, lock_005)
+{
+  Hooks hooks;
+  RBUF_Lock_t lock;
+  RBUF_Span_t spans[2];
+
+  RBUF_LockInitHooks(&lock, HookEnter, HookExit, &hooks);
+  RBUF_LockedInit(&locked, data, sizeof(data), &lock);
+
+  EXPECT_TRUE(RBUF_LockedWriteUint8(&locked, 0x01));
+  EXPECT_TRUE(RBUF_LockedWriteUint16(&locked, 0x0203));
+  EXPECT_TRUE(RBUF_LockedWriteUint32(&locked, 0x04050607U));
+  EXPECT_EQ(hooks.enter_count, 6);
+  EXPECT_EQ(RBUF_LockedReadUint8(&locked), 0x01);
+  EXPECT_TRUE(RBUF_LockedReadCopyBlock(&buf, &locked, 6));
+  EXPECT_FALSE(RBUF_LockedReadCopyBlock(&buf, &locked, 1));
+  EXPECT_EQ(memcmp(buf_data, "\x02\x03\x04\x05\x06\x07", 6), 0);
+  EXPECT_EQ(RBUF_LockedReadUint8(&locked), 0x00); // Empty
+  EXPECT_EQ(hooks.enter_count, 12);
+
+  ASSERT_EQ(RBUF_LockedWriteReserve(&locked, spans), sizeof(data) - 1U);
+  memcpy(spans[0].data, "xyz", 3);
+  EXPECT_TRUE(RBUF_LockedWriteCommit(&locked, 3));
+  EXPECT_FALSE(RBUF_LockedWriteCommit(&locked, sizeof(data)));
+  ASSERT_EQ(RBUF_LockedReadPeek(&locked, spans), 3U);
+  EXPECT_EQ(memcmp(spans[0].data, "xyz", 3), 0);
+  EXPECT_TRUE(RBUF_LockedReadCommit(&locked, 3));
+  EXPECT_FALSE(RBUF_LockedReadCommit(&locked, 1));
+  EXPECT_EQ(hooks.enter_count, 18);
+  EXPECT_EQ(hooks.depth, 0);
+
+  EXPECT_FALSE(RBUF_LockedWriteUint8(nullptr, 0));
+  EXPECT_FALSE(RBUF_LockedWriteUint16(nullptr, 0));
+  EXPECT_FALSE(RBUF_LockedWriteUint32(nullptr, 0));
+  EXPECT_EQ(RBUF_LockedReadUint8(nullptr), 0);
+  EXPECT_FALSE(RBUF_LockedReadCopyBlock(&buf, nullptr, 1));
+  EXPECT_EQ(RBUF_LockedWriteReserve(nullptr, spans), 0U);
+  EXPECT_FALSE(RBUF_LockedWriteCommit(nullptr, 0));
+  EXPECT_EQ(RBUF_LockedReadPeek(nullptr, spans), 0U);
+  EXPECT_FALSE(RBUF_LockedReadCommit(nullptr, 0));
+}
+
+/**
+ * \brief Watermark transitions are notified inside the critical section
+ */
+TEST_F(RBUF_Lock_Fixture, lock_006)
+{
+  Hooks hooks;
+  RBUF_Lock_t lock;
+  RBUF_Watermark_t watermark;
+  std::vector<int> depths; // Lock depth at each watermark event
+  auto on_watermark = [](RBUF_t *, RBUF_WatermarkEvent_t, void *context) {
+    auto *observed = static_cast<std::pair<Hooks *, std::vector<int> *> *>(context);
+    observed->second->push_back(observed->first->depth);
+  };
+  std::pair<Hooks *, std::vector<int> *> observed(&hooks, &depths);
+
+  RBUF_LockInitHooks(&lock, HookEnter, HookExit, &hooks);
+  RBUF_LockedInit(&locked, data, sizeof(data), &lock);
+  ASSERT_TRUE(RBUF_SetWatermark(&locked.ring, &watermark, 2, 4, on_watermark, &observed));
+
+  EXPECT_TRUE(RBUF_LockedWriteString(&locked, "abcd", 4)); // High
+  EXPECT_EQ(RBUF_LockedReadCopyRaw(&buf, &locked, 3), 3);  // Low
+  EXPECT_TRUE(RBUF_LockedWriteCommit(&locked, 3));         // High
+  EXPECT_TRUE(RBUF_LockedReadCommit(&locked, 3));          // Low
+  EXPECT_EQ(depths, std::vector<int>({1, 1, 1, 1}));
+}
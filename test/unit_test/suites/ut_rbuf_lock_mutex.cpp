@@ -0,0 +1,86 @@
+//! \file ut_rbuf_lock_mutex.cpp
+//! \brief Ring Buffer pthread mutex policy unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <thread>
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_lock_mutex.h"
+}
+
+using namespace testing;
+
+class RBUF_LockMutex_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_LockInitMutex(&lock, &mutex);
+    RBUF_LockedInit(&locked, data, sizeof(data), &lock);
+  }
+  // attributes
+  pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+  RBUF_Lock_t lock;
+  RBUF_Locked_t locked;
+  std::uint8_t data[32];
+};
+
+/**
+ * \brief Writer and reader threads transfer a byte sequence, mutex released after each call
+ */
+TEST_F(RBUF_LockMutex_Fixture, lock_mutex_001)
+{
+  constexpr int TOTAL = 20000;
+
+  std::thread writer([this]() {
+    for (int sent = 0; sent < TOTAL;)
+    {
+      char value = (char) sent;
+      if (RBUF_LockedWriteString(&locked, &value, 1) == true)
+      {
+        sent++;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int received = 0;
+  bool in_order = true;
+  std::uint8_t buf_data[16];
+  BUF_t buf;
+  while (received < TOTAL)
+  {
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+    RBUF_size_t read = RBUF_LockedReadCopyRaw(&buf, &locked, sizeof(buf_data));
+    for (RBUF_size_t i = 0; i < read; i++)
+    {
+      in_order &= (buf_data[i] == (uint8_t) (received + i));
+    }
+    received += read;
+    if (read == 0U)
+    {
+      std::this_thread::yield();
+    }
+  }
+  writer.join();
+  EXPECT_TRUE(in_order);
+  EXPECT_EQ(pthread_mutex_trylock(&mutex), 0);
+  EXPECT_EQ(pthread_mutex_unlock(&mutex), 0);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_LockMutex_Fixture, lock_mutex_002)
+{
+  RBUF_Lock_t untouched = {nullptr, nullptr, nullptr};
+  RBUF_LockInitMutex(&untouched, nullptr);
+  EXPECT_EQ(untouched.enter, nullptr);
+  RBUF_LockInitMutex(nullptr, &mutex);
+}
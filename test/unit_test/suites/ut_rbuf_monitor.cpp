@@ -0,0 +1,189 @@
+//! \file ut_rbuf_monitor.cpp
+//! \brief Ring Buffer consistent state snapshot unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_monitor.h"
+}
+
+using namespace testing;
+
+class RBUF_Monitor_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, sizeof(data));
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+  // attributes
+  RBUF_t rbuf;
+  std::uint8_t data[16];
+  BUF_t buf;
+  std::uint8_t buf_data[64];
+  RBUF_Monitor_t monitor;
+  RBUF_Snapshot_t snapshot;
+};
+
+/**
+ * \brief Snapshot follows writes and reads, across rollover
+ */
+TEST_F(RBUF_Monitor_Fixture, monitor_001)
+{
+  ASSERT_TRUE(RBUF_MonitorAttach(&rbuf, &monitor));
+  ASSERT_TRUE(RBUF_MonitorSnapshot(&monitor, &snapshot, 0));
+  EXPECT_EQ(snapshot.used_size, 0);
+  EXPECT_EQ(snapshot.free_size, 15);
+
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "0123456789", 10));
+  EXPECT_TRUE(RBUF_WriteUint8(&rbuf, 'a'));
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 8));
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "bcdefgh", 7));
+  ASSERT_TRUE(RBUF_MonitorSnapshot(&monitor, &snapshot, 0));
+  EXPECT_EQ(snapshot.write_index, 2);
+  EXPECT_EQ(snapshot.read_index, 8);
+  EXPECT_EQ(snapshot.used_size, 10);
+  EXPECT_EQ(snapshot.free_size, 5);
+  EXPECT_EQ(snapshot.peak, 11);
+  EXPECT_EQ(snapshot.written, 18U);
+  EXPECT_EQ(snapshot.read, 8U);
+  EXPECT_EQ(snapshot.writes, 3U);
+  EXPECT_EQ(snapshot.reads, 1U);
+
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, 10));
+  ASSERT_TRUE(RBUF_MonitorSnapshot(&monitor, &snapshot, 0));
+  EXPECT_EQ(snapshot.used_size, 0);
+  EXPECT_EQ(snapshot.read_index, 2);
+  EXPECT_EQ(snapshot.peak, 11);
+}
+
+/**
+ * \brief Data present at attach counts in used size, not in counters
+ */
+TEST_F(RBUF_Monitor_Fixture, monitor_002)
+{
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "abc", 3));
+  ASSERT_TRUE(RBUF_MonitorAttach(&rbuf, &monitor));
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 2));
+  ASSERT_TRUE(RBUF_MonitorSnapshot(&monitor, &snapshot, 0));
+  EXPECT_EQ(snapshot.used_size, 1);
+  EXPECT_EQ(snapshot.peak, 3);
+  EXPECT_EQ(snapshot.written, 0U);
+  EXPECT_EQ(snapshot.read, 2U);
+
+  RBUF_MonitorDetach(&rbuf);
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "d", 1));
+  ASSERT_TRUE(RBUF_MonitorSnapshot(&monitor, &snapshot, 0));
+  EXPECT_EQ(snapshot.used_size, 1);
+}
+
+/**
+ * \brief Side updating or reader published ahead of writer, snapshot fails and is left unchanged
+ */
+TEST_F(RBUF_Monitor_Fixture, monitor_003)
+{
+  ASSERT_TRUE(RBUF_MonitorAttach(&rbuf, &monitor));
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "abc", 3));
+  snapshot = {};
+  snapshot.used_size = 42;
+
+  monitor.write.sequence++; // Writer preempted mid update
+  EXPECT_FALSE(RBUF_MonitorSnapshot(&monitor, &snapshot, 3));
+  EXPECT_EQ(snapshot.used_size, 42);
+  monitor.write.sequence++;
+
+  monitor.read.bytes = 4; // Reader published bytes the writer has not yet
+  EXPECT_FALSE(RBUF_MonitorSnapshot(&monitor, &snapshot, 3));
+  EXPECT_EQ(snapshot.used_size, 42);
+  monitor.read.bytes = 0;
+  EXPECT_TRUE(RBUF_MonitorSnapshot(&monitor, &snapshot, 0));
+  EXPECT_EQ(snapshot.used_size, 3);
+}
+
+/**
+ * \brief Monitoring thread never sees an inconsistent state while a writer and a reader run
+ */
+TEST_F(RBUF_Monitor_Fixture, monitor_004)
+{
+  constexpr uint32_t TOTAL = 20000;
+  std::atomic<bool> done{false};
+  ASSERT_TRUE(RBUF_MonitorAttach(&rbuf, &monitor));
+
+  std::thread writer([this]() {
+    uint32_t sent = 0;
+    while (sent < TOTAL)
+    {
+      if (RBUF_WriteString(&rbuf, "abc", 3) == true)
+      {
+        sent += 3;
+      }
+      else
+      {
+        std::this_thread::yield();
+      }
+    }
+  });
+  std::thread reader([this, &done]() {
+    uint32_t received = 0;
+    while (received < TOTAL)
+    {
+      BUF_t local;
+      uint8_t local_data[5];
+      BUF_InitEmpty(&local, local_data, sizeof(local_data));
+      RBUF_size_t read = RBUF_ReadCopyRaw(&local, &rbuf, sizeof(local_data));
+      received += read;
+      if (read == 0U)
+      {
+        std::this_thread::yield();
+      }
+    }
+    done = true;
+  });
+
+  uint32_t taken = 0;
+  bool consistent = true;
+  while (done == false)
+  {
+    if (RBUF_MonitorSnapshot(&monitor, &snapshot, 8) == true)
+    {
+      RBUF_size_t distance = (RBUF_size_t) ((snapshot.write_index + sizeof(data) - snapshot.read_index) % sizeof(data));
+      consistent &= (distance == snapshot.used_size);
+      consistent &= ((snapshot.used_size + snapshot.free_size) == (sizeof(data) - 1U));
+      consistent &= ((snapshot.written - snapshot.read) == snapshot.used_size);
+      consistent &= (snapshot.used_size <= snapshot.peak);
+      taken++;
+    }
+    std::this_thread::yield();
+  }
+  writer.join();
+  reader.join();
+  EXPECT_TRUE(consistent);
+  EXPECT_GT(taken, 0U);
+  ASSERT_TRUE(RBUF_MonitorSnapshot(&monitor, &snapshot, 0));
+  EXPECT_EQ(snapshot.written, TOTAL + 1U); // Last write rounds up to 3 bytes
+  EXPECT_EQ(snapshot.used_size, 1);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Monitor_Fixture, monitor_005)
+{
+  RBUF_t empty;
+  RBUF_InitEmpty(&empty, nullptr, 0);
+
+  EXPECT_FALSE(RBUF_MonitorAttach(nullptr, &monitor));
+  EXPECT_FALSE(RBUF_MonitorAttach(&rbuf, nullptr));
+  EXPECT_FALSE(RBUF_MonitorAttach(&empty, &monitor));
+  EXPECT_EQ(rbuf.monitor, nullptr);
+  ASSERT_TRUE(RBUF_MonitorAttach(&rbuf, &monitor));
+  EXPECT_FALSE(RBUF_MonitorSnapshot(nullptr, &snapshot, 0));
+  EXPECT_FALSE(RBUF_MonitorSnapshot(&monitor, nullptr, 0));
+  RBUF_MonitorDetach(nullptr);
+}
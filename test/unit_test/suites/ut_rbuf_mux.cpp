@@ -0,0 +1,165 @@
+//! \file ut_rbuf_mux.cpp
+//! \brief Ring Buffer multiplexed channels unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_mux.h"
+}
+
+using namespace testing;
+
+namespace
+{
+
+struct Received
+{
+  std::vector<std::string> records;
+  std::vector<uint8_t> channels;
+  int split_count = 0;
+};
+
+void Handler(uint8_t channel, const RBUF_Span_t spans[2], void *context)
+{
+  Received *received = static_cast<Received *>(context);
+  std::string record((const char *) spans[0].data, spans[0].size);
+
+  if (spans[1].size > 0U)
+  {
+    record.append((const char *) spans[1].data, spans[1].size);
+    received->split_count++;
+  }
+  received->records.push_back(record);
+  received->channels.push_back(channel);
+}
+
+} // namespace
+
+class RBUF_Mux_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_MuxInit(&mux, data, sizeof(data), channels, CHANNEL_COUNT);
+  }
+  bool Write(uint8_t channel, const char *text)
+  {
+    return RBUF_MuxWrite(&mux, channel, (const uint8_t *) text, (RBUF_size_t) strlen(text));
+  }
+  // attributes
+  static constexpr uint8_t CHANNEL_COUNT = 4;
+  RBUF_Mux_t mux;
+  std::uint8_t data[32];
+  RBUF_MuxChannel_t channels[CHANNEL_COUNT];
+  Received received;
+};
+
+/**
+ * \brief Records are dispatched in arrival order to their channel handler
+ */
+TEST_F(RBUF_Mux_Fixture, mux_001)
+{
+  Received other;
+  ASSERT_TRUE(RBUF_MuxSetChannel(&mux, 0, 31, Handler, &received));
+  ASSERT_TRUE(RBUF_MuxSetChannel(&mux, 2, 31, Handler, &other));
+
+  EXPECT_TRUE(Write(0, "ab"));
+  EXPECT_TRUE(Write(2, "cde"));
+  EXPECT_TRUE(Write(0, ""));
+  EXPECT_EQ(RBUF_MuxGetUsedSize(&mux, 0), RBUF_MUX_RECORD_SIZE(2) + RBUF_MUX_RECORD_SIZE(0));
+  EXPECT_EQ(RBUF_MuxGetUsedSize(&mux, 2), RBUF_MUX_RECORD_SIZE(3));
+
+  EXPECT_EQ(RBUF_MuxDispatch(&mux, 10), 3);
+  ASSERT_EQ(received.records.size(), 2U);
+  EXPECT_EQ(received.records[0], "ab");
+  EXPECT_EQ(received.records[1], "");
+  ASSERT_EQ(other.records.size(), 1U);
+  EXPECT_EQ(other.records[0], "cde");
+  EXPECT_EQ(other.channels[0], 2);
+  EXPECT_EQ(RBUF_MuxGetUsedSize(&mux, 0), 0U);
+  EXPECT_TRUE(RBUF_IsEmpty(&mux.ring));
+}
+
+/**
+ * \brief Quota refuses a noisy channel while others still write
+ */
+TEST_F(RBUF_Mux_Fixture, mux_002)
+{
+  ASSERT_TRUE(RBUF_MuxSetChannel(&mux, 1, RBUF_MUX_RECORD_SIZE(4) * 2, Handler, &received));
+  ASSERT_TRUE(RBUF_MuxSetChannel(&mux, 3, RBUF_MUX_RECORD_SIZE(4), Handler, &received));
+
+  EXPECT_TRUE(Write(1, "aaaa"));
+  EXPECT_TRUE(Write(1, "bbbb"));
+  EXPECT_FALSE(Write(1, "cccc"));
+  EXPECT_EQ(channels[1].refused, 1U);
+  EXPECT_TRUE(Write(3, "dddd"));
+  EXPECT_FALSE(Write(3, "e"));
+
+  EXPECT_EQ(RBUF_MuxDispatch(&mux, 1), 1);
+  EXPECT_TRUE(Write(1, "ffff")); // Room again once dispatched
+  EXPECT_EQ(RBUF_MuxDispatch(&mux, 10), 3);
+  ASSERT_EQ(received.records.size(), 4U);
+  EXPECT_EQ(received.records[3], "ffff");
+}
+
+/**
+ * \brief Ring full, record across rollover is split in two spans, channel without handler drops
+ */
+TEST_F(RBUF_Mux_Fixture, mux_003)
+{
+  ASSERT_TRUE(RBUF_MuxSetChannel(&mux, 0, 31, Handler, &received));
+
+  EXPECT_TRUE(Write(0, "0123456789abcdefghijklmno")); // 28 bytes
+  EXPECT_FALSE(Write(1, "ab"));                       // Ring full
+  EXPECT_EQ(RBUF_MuxDispatch(&mux, 10), 1);
+  EXPECT_TRUE(Write(0, "rollover")); // Payload from 31 to 6
+  EXPECT_TRUE(Write(1, "xy"));
+  EXPECT_EQ(RBUF_MuxDispatch(&mux, 10), 2);
+  EXPECT_EQ(channels[1].dropped, 1U);
+  ASSERT_EQ(received.records.size(), 2U);
+  EXPECT_EQ(received.records[1], "rollover");
+  EXPECT_EQ(received.split_count, 1);
+}
+
+/**
+ * \brief Corrupted record drops ring content and releases channel quotas
+ */
+TEST_F(RBUF_Mux_Fixture, mux_004)
+{
+  ASSERT_TRUE(RBUF_MuxSetChannel(&mux, 0, RBUF_MUX_RECORD_SIZE(2), Handler, &received));
+  EXPECT_TRUE(Write(0, "ab"));
+  data[0] = CHANNEL_COUNT; // Unknown channel
+  EXPECT_EQ(RBUF_MuxDispatch(&mux, 10), 0);
+  EXPECT_TRUE(RBUF_IsEmpty(&mux.ring));
+
+  EXPECT_EQ(RBUF_MuxGetUsedSize(&mux, 0), 0U);
+  EXPECT_TRUE(Write(0, "cd"));
+  EXPECT_EQ(RBUF_MuxDispatch(&mux, 10), 1U);
+  ASSERT_EQ(received.records.size(), 1U);
+  EXPECT_EQ(received.records[0], "cd");
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Mux_Fixture, mux_005)
+{
+  EXPECT_FALSE(RBUF_MuxSetChannel(&mux, CHANNEL_COUNT, 8, Handler, &received));
+  EXPECT_FALSE(RBUF_MuxSetChannel(nullptr, 0, 8, Handler, &received));
+  EXPECT_FALSE(RBUF_MuxWrite(&mux, CHANNEL_COUNT, (const uint8_t *) "a", 1));
+  EXPECT_FALSE(RBUF_MuxWrite(&mux, 0, nullptr, 1));
+  EXPECT_FALSE(RBUF_MuxWrite(nullptr, 0, (const uint8_t *) "a", 1));
+  EXPECT_EQ(RBUF_MuxDispatch(nullptr, 1), 0);
+  EXPECT_EQ(RBUF_MuxGetUsedSize(nullptr, 0), 0);
+  EXPECT_EQ(RBUF_MuxGetUsedSize(&mux, CHANNEL_COUNT), 0);
+
+  RBUF_MuxInit(&mux, nullptr, 0, nullptr, CHANNEL_COUNT);
+  EXPECT_EQ(mux.channel_count, 0);
+  EXPECT_FALSE(RBUF_MuxWrite(&mux, 0, (const uint8_t *) "a", 1));
+  RBUF_MuxInit(nullptr, data, sizeof(data), channels, CHANNEL_COUNT);
+}
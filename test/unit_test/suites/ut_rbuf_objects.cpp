@@ -0,0 +1,203 @@
+//! \file ut_rbuf_objects.cpp
+//! \brief Ring of heterogeneous C++ objects unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ring_buffer/ring_buffer_objects.hpp"
+
+using namespace testing;
+
+namespace
+{
+
+struct Tracked
+{
+  explicit Tracked(int *counter, int value) : counter(counter), value(value)
+  {
+    (*counter)++;
+  }
+  ~Tracked()
+  {
+    (*counter)--;
+  }
+  int *counter;
+  int value;
+};
+
+struct Throwing
+{
+  explicit Throwing(bool fail)
+  {
+    if (fail == true)
+    {
+      throw std::runtime_error("constructor failed");
+    }
+  }
+  std::uint8_t padding[40];
+};
+
+struct alignas(16) Wide
+{
+  double values[3];
+};
+
+} // namespace
+
+class RBUF_Objects_Fixture : public ::testing::Test
+{
+protected:
+  // attributes
+  alignas(std::max_align_t) std::uint8_t storage[256];
+};
+
+/**
+ * \brief Emplace and consume objects of different types in order
+ */
+TEST_F(RBUF_Objects_Fixture, objects_001)
+{
+  rbuf::ObjectRing ring(storage, sizeof(storage));
+  EXPECT_TRUE(ring.IsEmpty());
+
+  ASSERT_NE(ring.Emplace<std::string>("hello"), nullptr);
+  ASSERT_NE(ring.Emplace<std::vector<int>>(std::initializer_list<int>{1, 2, 3}), nullptr);
+  Wide *wide = ring.Emplace<Wide>(Wide{{1.0, 2.0, 3.0}});
+  ASSERT_NE(wide, nullptr);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(wide) % alignof(Wide), 0U);
+
+  EXPECT_TRUE(ring.Holds<std::string>());
+  EXPECT_EQ(ring.Front<std::vector<int>>(), nullptr);
+  EXPECT_EQ(*ring.Front<std::string>(), "hello");
+  EXPECT_TRUE(ring.Pop());
+
+  std::vector<int> values;
+  EXPECT_FALSE(ring.PopInto(*std::make_unique<std::string>()));
+  EXPECT_TRUE(ring.PopInto(values));
+  EXPECT_EQ(values, (std::vector<int>{1, 2, 3}));
+
+  ASSERT_NE(ring.Front<Wide>(), nullptr);
+  EXPECT_EQ(ring.Front<Wide>()->values[2], 3.0);
+  EXPECT_TRUE(ring.Pop());
+  EXPECT_TRUE(ring.IsEmpty());
+  EXPECT_FALSE(ring.Pop());
+}
+
+/**
+ * \brief Destructors run on pop and when the ring is destroyed
+ */
+TEST_F(RBUF_Objects_Fixture, objects_002)
+{
+  int alive = 0;
+  {
+    rbuf::ObjectRing ring(storage, sizeof(storage));
+    ring.Emplace<Tracked>(&alive, 1);
+    ring.Emplace<Tracked>(&alive, 2);
+    ring.Emplace<std::unique_ptr<Tracked>>(std::make_unique<Tracked>(&alive, 3));
+    EXPECT_EQ(alive, 3);
+    EXPECT_TRUE(ring.Pop());
+    EXPECT_EQ(alive, 2);
+  }
+  EXPECT_EQ(alive, 0);
+}
+
+/**
+ * \brief Objects wrap around storage end, full ring refuses emplace
+ */
+TEST_F(RBUF_Objects_Fixture, objects_003)
+{
+  rbuf::ObjectRing ring(storage, sizeof(storage));
+  int alive = 0;
+  int next = 0;
+  int expected = 0;
+
+  for (int round = 0; round < 50; round++)
+  {
+    while (ring.Emplace<Tracked>(&alive, next) != nullptr)
+    {
+      next++;
+    }
+    EXPECT_FALSE(ring.IsEmpty());
+    EXPECT_LE(ring.GetUsedSize(), sizeof(storage));
+    for (int i = 0; i < 1 + (round % 3); i++)
+    {
+      ASSERT_TRUE(ring.Holds<Tracked>());
+      EXPECT_EQ(ring.Front<Tracked>()->value, expected);
+      EXPECT_TRUE(ring.Pop());
+      expected++;
+    }
+    /* Bigger object only fits once enough was consumed */
+    std::string *text = ring.Emplace<std::string>(32, 'x');
+    if (text != nullptr)
+    {
+      next++; // Keeps a slot in the sequence
+    }
+    while ((ring.Holds<std::string>() == true) || ((ring.Holds<Tracked>() == true) && (round % 2 == 0)))
+    {
+      if (ring.Holds<Tracked>() == true)
+      {
+        EXPECT_EQ(ring.Front<Tracked>()->value, expected);
+      }
+      EXPECT_TRUE(ring.Pop());
+      expected++;
+    }
+  }
+  ring.Clear();
+  EXPECT_EQ(alive, 0);
+  EXPECT_EQ(ring.GetUsedSize(), 0U);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Objects_Fixture, objects_004)
+{
+  rbuf::ObjectRing none(nullptr, sizeof(storage));
+  EXPECT_EQ(none.Emplace<int>(1), nullptr);
+  EXPECT_FALSE(none.Pop());
+
+  rbuf::ObjectRing tiny(storage, 8);
+  EXPECT_EQ(tiny.Emplace<int>(1), nullptr);
+
+  rbuf::ObjectRing misaligned(storage + 1, sizeof(storage) - 1);
+  int *value = misaligned.Emplace<int>(7);
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(value) % alignof(int), 0U);
+}
+
+/**
+ * \brief Throwing constructor leaves the ring unchanged, also when the entry would wrap
+ */
+TEST_F(RBUF_Objects_Fixture, objects_005)
+{
+  rbuf::ObjectRing ring(storage, sizeof(storage));
+  int alive = 0;
+
+  EXPECT_THROW(ring.Emplace<Throwing>(true), std::runtime_error);
+  EXPECT_TRUE(ring.IsEmpty());
+  EXPECT_EQ(ring.GetUsedSize(), 0U);
+
+  while (ring.Emplace<Throwing>(false) != nullptr)
+  {
+  }
+  EXPECT_TRUE(ring.Pop());
+  EXPECT_TRUE(ring.Pop());
+  std::size_t used = ring.GetUsedSize();
+  EXPECT_THROW(ring.Emplace<Throwing>(true), std::runtime_error);
+  EXPECT_EQ(ring.GetUsedSize(), used);
+
+  ASSERT_NE(ring.Emplace<Tracked>(&alive, 3), nullptr);
+  while (ring.Holds<Throwing>() == true)
+  {
+    EXPECT_TRUE(ring.Pop());
+  }
+  ASSERT_TRUE(ring.Holds<Tracked>());
+  EXPECT_EQ(ring.Front<Tracked>()->value, 3);
+  ring.Clear();
+  EXPECT_EQ(alive, 0);
+}
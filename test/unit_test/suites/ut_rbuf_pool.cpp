@@ -0,0 +1,139 @@
+//! \file ut_rbuf_pool.cpp
+//! \brief Ring Buffer storage pool unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_pool.h"
+}
+
+using namespace testing;
+
+class RBUF_Pool_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_PoolInit(&pool, arena, ARENA_SIZE, false);
+  }
+  // attributes
+  static constexpr size_t ARENA_SIZE = 256;
+
+  RBUF_Pool_t pool;
+  alignas(64) std::uint8_t arena[ARENA_SIZE];
+};
+
+/**
+ * \brief Create rings, storage is carved in sequence and rounded to size class
+ */
+TEST_F(RBUF_Pool_Fixture, pool_001)
+{
+  RBUF_t a, b;
+
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &a, 10));
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &b, 20));
+  EXPECT_EQ(a.data, &arena[0]);
+  EXPECT_EQ(a.size, 10);
+  EXPECT_EQ(b.data, &arena[16]);
+  EXPECT_EQ(b.size, 20);
+  EXPECT_EQ(RBUF_PoolGetUsedSize(&pool), 16U + 32U);
+  EXPECT_EQ(RBUF_PoolGetReservedSize(&pool), 16U + 32U);
+  EXPECT_EQ(RBUF_PoolGetFreeSize(&pool), ARENA_SIZE - 48);
+
+  EXPECT_TRUE(RBUF_WriteString(&b, "Hello", 5));
+  EXPECT_EQ(RBUF_GetUsedSize(&b), 5);
+}
+
+/**
+ * \brief Destroyed storage is reused by the next ring of the same class
+ */
+TEST_F(RBUF_Pool_Fixture, pool_002)
+{
+  RBUF_t a, b, c;
+
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &a, 30));
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &b, 30));
+  uint8_t *a_data = a.data;
+  RBUF_PoolDestroy(&pool, &a);
+  EXPECT_EQ(a.data, nullptr);
+  EXPECT_EQ(a.size, 0);
+  EXPECT_EQ(RBUF_PoolGetUsedSize(&pool), 32U);
+  EXPECT_EQ(RBUF_PoolGetReservedSize(&pool), 64U);
+
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &c, 17));
+  EXPECT_EQ(c.data, a_data);
+  EXPECT_EQ(RBUF_PoolGetReservedSize(&pool), 64U);
+}
+
+/**
+ * \brief Arena exhausted
+ */
+TEST_F(RBUF_Pool_Fixture, pool_003)
+{
+  RBUF_t a, b;
+
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &a, ARENA_SIZE));
+  EXPECT_FALSE(RBUF_PoolCreate(&pool, &b, 1));
+  RBUF_PoolDestroy(&pool, &a);
+  EXPECT_FALSE(RBUF_PoolCreate(&pool, &b, 1)); /* Only a 256 bytes class block is free */
+  EXPECT_TRUE(RBUF_PoolCreate(&pool, &b, 250));
+}
+
+/**
+ * \brief Cache line padding
+ */
+TEST_F(RBUF_Pool_Fixture, pool_004)
+{
+  RBUF_t a, b;
+
+  RBUF_PoolInit(&pool, &arena[1], ARENA_SIZE - 1, true);
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &a, 1));
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &b, 1));
+  EXPECT_EQ((uintptr_t) a.data % RBUF_POOL_CACHE_LINE, 0U);
+  EXPECT_EQ(b.data - a.data, RBUF_POOL_CACHE_LINE);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Pool_Fixture, pool_005)
+{
+  RBUF_t a;
+
+  EXPECT_FALSE(RBUF_PoolCreate(nullptr, &a, 1));
+  EXPECT_FALSE(RBUF_PoolCreate(&pool, nullptr, 1));
+  EXPECT_FALSE(RBUF_PoolCreate(&pool, &a, 0));
+  EXPECT_EQ(RBUF_PoolAlloc(&pool, 0), nullptr);
+  RBUF_PoolDestroy(nullptr, &a);
+  RBUF_PoolFree(&pool, nullptr, 1);
+  EXPECT_EQ(RBUF_PoolGetUsedSize(nullptr), 0U);
+
+  RBUF_PoolInit(&pool, nullptr, ARENA_SIZE, false);
+  EXPECT_FALSE(RBUF_PoolCreate(&pool, &a, 1));
+}
+
+/**
+ * \brief Quarter power of two size classes, rounding reported as wasted
+ */
+TEST_F(RBUF_Pool_Fixture, pool_006)
+{
+  RBUF_t a, b, c;
+
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &a, 33));  /* 48 bytes class */
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &b, 65));  /* 80 bytes class */
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &c, 100)); /* 112 bytes class */
+  EXPECT_EQ(b.data - a.data, 48);
+  EXPECT_EQ(c.data - b.data, 80);
+  EXPECT_EQ(RBUF_PoolGetUsedSize(&pool), 48U + 80U + 112U);
+  EXPECT_EQ(RBUF_PoolGetWastedSize(&pool), 15U + 15U + 12U);
+
+  RBUF_PoolDestroy(&pool, &b);
+  EXPECT_EQ(RBUF_PoolGetUsedSize(&pool), 48U + 112U);
+  EXPECT_EQ(RBUF_PoolGetWastedSize(&pool), 15U + 12U);
+  ASSERT_TRUE(RBUF_PoolCreate(&pool, &b, 80));
+  EXPECT_EQ(b.data, a.data + 48);
+  EXPECT_EQ(RBUF_PoolGetWastedSize(&pool), 15U + 12U);
+  EXPECT_EQ(RBUF_PoolGetWastedSize(nullptr), 0U);
+}
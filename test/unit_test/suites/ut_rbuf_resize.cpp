@@ -0,0 +1,97 @@
+//! \file ut_rbuf_resize.cpp
+//! \brief Ring rbuf resize unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer.h"
+}
+
+using namespace testing;
+
+namespace
+{
+
+void WatermarkCb(RBUF_t *buffer, RBUF_WatermarkEvent_t event, void *context)
+{
+  (void) buffer;
+  (void) event;
+  (void) context;
+}
+
+} // namespace
+
+class RBUF_Resize_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+  // attributes
+  RBUF_t rbuf;
+  static constexpr uint8_t DATA_SIZE = 5;
+  std::uint8_t data[DATA_SIZE];
+  std::uint8_t large[12];
+  std::uint8_t small[3];
+  BUF_t buf;
+  std::uint8_t buf_data[16];
+};
+
+/**
+ * \brief Grow wrapped buffer, content moves to the start of new storage
+ */
+TEST_F(RBUF_Resize_Fixture, resize_001)
+{
+  rbuf.read_index = 3;
+  rbuf.write_index = 3;
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "abcd", 4));
+  EXPECT_TRUE(RBUF_IsFull(&rbuf));
+
+  ASSERT_TRUE(RBUF_Resize(&rbuf, large, sizeof(large)));
+  EXPECT_EQ(rbuf.data, large);
+  EXPECT_EQ(rbuf.size, sizeof(large));
+  EXPECT_EQ(rbuf.read_index, 0);
+  EXPECT_EQ(rbuf.write_index, 4);
+  EXPECT_EQ(RBUF_GetFreeSize(&rbuf), 7);
+
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "efghijk", 7));
+  EXPECT_TRUE(RBUF_ReadCopyBlock(&buf, &rbuf, 11));
+  EXPECT_EQ(0, memcmp(buf_data, "abcdefghijk", 11));
+}
+
+/**
+ * \brief Shrink only when content and watermarks fit
+ */
+TEST_F(RBUF_Resize_Fixture, resize_002)
+{
+  RBUF_Watermark_t watermark;
+
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "abc", 3));
+  EXPECT_FALSE(RBUF_Resize(&rbuf, small, sizeof(small)));
+  EXPECT_EQ(rbuf.data, data);
+  EXPECT_EQ(RBUF_ReadUint8(&rbuf), 'a');
+
+  ASSERT_TRUE(RBUF_SetWatermark(&rbuf, &watermark, 1, 3, WatermarkCb, nullptr));
+  EXPECT_FALSE(RBUF_Resize(&rbuf, small, sizeof(small)));
+  RBUF_ClearWatermark(&rbuf);
+
+  ASSERT_TRUE(RBUF_Resize(&rbuf, small, sizeof(small)));
+  EXPECT_TRUE(RBUF_IsFull(&rbuf));
+  EXPECT_EQ(small[0], 'b');
+  EXPECT_EQ(small[1], 'c');
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Resize_Fixture, resize_003)
+{
+  EXPECT_FALSE(RBUF_Resize(nullptr, large, sizeof(large)));
+  EXPECT_FALSE(RBUF_Resize(&rbuf, nullptr, sizeof(large)));
+  EXPECT_FALSE(RBUF_Resize(&rbuf, large, 0));
+  EXPECT_EQ(rbuf.data, data);
+}
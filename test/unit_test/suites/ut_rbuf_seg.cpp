@@ -0,0 +1,174 @@
+//! \file ut_rbuf_seg.cpp
+//! \brief Segmented Ring Buffer unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_seg.h"
+}
+
+using namespace testing;
+
+class RBUF_Seg_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_PoolInit(&pool, arena, ARENA_SIZE, false);
+    RBUF_SegInit(&seg, &pool, SEGMENT_SIZE, 0);
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+  void TearDown()
+  {
+    RBUF_SegDestroy(&seg);
+    EXPECT_EQ(RBUF_PoolGetUsedSize(&pool), 0U);
+  }
+  // attributes
+  static constexpr size_t ARENA_SIZE = 256;
+  static constexpr RBUF_size_t SEGMENT_SIZE = 32 - sizeof(RBUF_Segment_t); // One 32 bytes pool class
+
+  RBUF_Pool_t pool;
+  alignas(64) std::uint8_t arena[ARENA_SIZE];
+  RBUF_Seg_t seg;
+  BUF_t buf;
+  std::uint8_t buf_data[256];
+};
+
+/**
+ * \brief Grows by segment on write, shrinks on read keeping one spare
+ */
+TEST_F(RBUF_Seg_Fixture, seg_001)
+{
+  std::string text;
+  for (int i = 0; i < 100; i++)
+  {
+    text.push_back((char) ('a' + (i % 26)));
+  }
+
+  EXPECT_TRUE(RBUF_SegIsEmpty(&seg));
+  EXPECT_EQ(RBUF_SegGetSegmentCount(&seg), 0);
+  EXPECT_TRUE(RBUF_SegWriteString(&seg, text.data(), 100));
+  EXPECT_EQ(RBUF_SegGetUsedSize(&seg), 100U);
+  EXPECT_EQ(RBUF_SegGetSegmentCount(&seg), (100 + SEGMENT_SIZE - 1) / SEGMENT_SIZE);
+  EXPECT_TRUE(RBUF_SegWriteUint8(&seg, '!'));
+
+  EXPECT_EQ(RBUF_SegReadUint8(&seg), 'a');
+  EXPECT_TRUE(RBUF_SegReadCopyBlock(&buf, &seg, 60));
+  EXPECT_EQ(0, memcmp(buf_data, text.data() + 1, 60));
+  EXPECT_EQ(RBUF_SegGetSegmentCount(&seg), 3); // Read up to byte 61 of 101
+  EXPECT_NE(seg.spare, nullptr);
+  size_t pool_used = RBUF_PoolGetUsedSize(&pool);
+
+  EXPECT_EQ(RBUF_SegReadCopyRaw(&buf, &seg, 100), 40);
+  EXPECT_EQ(0, memcmp(buf_data + 60, text.data() + 61, 39));
+  EXPECT_EQ(buf_data[99], '!');
+  EXPECT_TRUE(RBUF_SegIsEmpty(&seg));
+  EXPECT_EQ(RBUF_SegGetSegmentCount(&seg), 1);
+  EXPECT_EQ(RBUF_PoolGetUsedSize(&pool), pool_used - 64U); // Spare already taken, drained ones go back
+  EXPECT_EQ(seg.write_offset, 0); // Restarts at segment start
+}
+
+/**
+ * \brief Peek spans the two oldest segments, commit releases in place
+ */
+TEST_F(RBUF_Seg_Fixture, seg_002)
+{
+  RBUF_Span_t spans[2];
+
+  EXPECT_EQ(RBUF_SegPeek(&seg, spans), 0);
+  EXPECT_EQ(spans[0].data, nullptr);
+  EXPECT_TRUE(RBUF_SegWriteString(&seg, "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOP", 52));
+  EXPECT_TRUE(RBUF_SegReadCommit(&seg, 20));
+
+  EXPECT_EQ(RBUF_SegPeek(&seg, spans), 24 + 4);
+  EXPECT_EQ(0, memcmp(spans[0].data, "klmn", 4));
+  EXPECT_EQ(spans[0].size, 4);
+  EXPECT_EQ(0, memcmp(spans[1].data, "opqrstuvwxyzABCDEFGHIJKL", 24));
+  EXPECT_EQ(spans[1].size, 24);
+
+  EXPECT_TRUE(RBUF_SegReadCommit(&seg, 28));
+  EXPECT_EQ(RBUF_SegPeek(&seg, spans), 4);
+  EXPECT_EQ(0, memcmp(spans[0].data, "MNOP", 4));
+  EXPECT_EQ(spans[1].size, 0);
+  EXPECT_FALSE(RBUF_SegReadCommit(&seg, 5));
+}
+
+/**
+ * \brief Write needing more segments than allowed fails without writing anything
+ */
+TEST_F(RBUF_Seg_Fixture, seg_003)
+{
+  RBUF_SegInit(&seg, &pool, SEGMENT_SIZE, 2);
+
+  EXPECT_TRUE(RBUF_SegWriteString(&seg, "0123456789", 10));
+  EXPECT_FALSE(RBUF_SegWriteString(&seg, "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOP", 40));
+  EXPECT_EQ(RBUF_SegGetUsedSize(&seg), 10U);
+  EXPECT_EQ(RBUF_SegGetSegmentCount(&seg), 1);
+  EXPECT_TRUE(RBUF_SegWriteString(&seg, "0123456789abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOP", 38));
+  EXPECT_FALSE(RBUF_SegWriteUint8(&seg, 0));
+  EXPECT_EQ(RBUF_SegGetUsedSize(&seg), 48U);
+
+  /* Pool exhaustion behaves the same */
+  RBUF_SegDestroy(&seg);
+  RBUF_SegInit(&seg, &pool, SEGMENT_SIZE, 0);
+  for (size_t i = 0; i < ARENA_SIZE / 32U; i++)
+  {
+    EXPECT_TRUE(RBUF_SegWriteString(&seg, "0123456789abcdefghijklmn", SEGMENT_SIZE));
+  }
+  EXPECT_FALSE(RBUF_SegWriteUint8(&seg, 0));
+}
+
+/**
+ * \brief Long stream through a small backlog keeps order and bounded memory
+ */
+TEST_F(RBUF_Seg_Fixture, seg_004)
+{
+  uint8_t next_write = 0;
+  uint8_t next_read = 0;
+  bool in_order = true;
+
+  for (int round = 0; round < 1000; round++)
+  {
+    for (int i = 0; i < 7; i++)
+    {
+      EXPECT_TRUE(RBUF_SegWriteUint8(&seg, next_write++));
+    }
+    while (RBUF_SegGetUsedSize(&seg) > 30U)
+    {
+      in_order &= (RBUF_SegReadUint8(&seg) == next_read++);
+    }
+  }
+  EXPECT_TRUE(in_order);
+  EXPECT_LE(RBUF_SegGetSegmentCount(&seg), 3);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Seg_Fixture, seg_005)
+{
+  RBUF_Span_t spans[2];
+  RBUF_Seg_t no_pool;
+  RBUF_SegInit(&no_pool, nullptr, SEGMENT_SIZE, 0);
+
+  EXPECT_FALSE(RBUF_SegWriteUint8(&no_pool, 0));
+  EXPECT_FALSE(RBUF_SegWriteString(&seg, nullptr, 1));
+  EXPECT_FALSE(RBUF_SegWriteString(nullptr, "a", 1));
+  EXPECT_EQ(RBUF_SegReadUint8(&seg), 0);
+  EXPECT_EQ(RBUF_SegReadUint8(nullptr), 0);
+  EXPECT_FALSE(RBUF_SegReadCopyBlock(&buf, &seg, 1));
+  EXPECT_FALSE(RBUF_SegReadCopyBlock(nullptr, &seg, 0));
+  EXPECT_EQ(RBUF_SegReadCopyRaw(&buf, nullptr, 1), 0);
+  EXPECT_EQ(RBUF_SegPeek(nullptr, spans), 0);
+  EXPECT_EQ(RBUF_SegPeek(&seg, nullptr), 0);
+  EXPECT_FALSE(RBUF_SegReadCommit(&seg, 1));
+  EXPECT_EQ(RBUF_SegGetUsedSize(nullptr), 0U);
+  EXPECT_EQ(RBUF_SegGetSegmentCount(nullptr), 0);
+  EXPECT_TRUE(RBUF_SegIsEmpty(nullptr));
+  RBUF_SegDestroy(nullptr);
+  RBUF_SegInit(nullptr, &pool, SEGMENT_SIZE, 0);
+}
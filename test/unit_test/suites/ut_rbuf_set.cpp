@@ -0,0 +1,137 @@
+//! \file ut_rbuf_set.cpp
+//! \brief Ring Buffer set unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_set.h"
+}
+
+using namespace testing;
+
+class RBUF_Set_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_SetInit(&set, rings, ready, RING_COUNT);
+    for (uint16_t i = 0; i < RING_COUNT; i++)
+    {
+      RBUF_InitEmpty(&rbuf[i], data[i], DATA_SIZE);
+      RBUF_SetAdd(&set, &rbuf[i], i);
+    }
+  }
+  // attributes
+  static constexpr uint16_t RING_COUNT = 200;
+  static constexpr uint8_t DATA_SIZE   = 5;
+
+  RBUF_Set_t set;
+  RBUF_t *rings[RING_COUNT];
+  uint32_t ready[RBUF_SET_WORDS(RING_COUNT)];
+  RBUF_t rbuf[RING_COUNT];
+  std::uint8_t data[RING_COUNT][DATA_SIZE];
+};
+
+/**
+ * \brief No ring ready after initialization
+ */
+TEST_F(RBUF_Set_Fixture, set_001)
+{
+  uint16_t id;
+  EXPECT_FALSE(RBUF_SetNextReady(&set, &id));
+  EXPECT_FALSE(RBUF_SetFirstReady(&set, &id));
+}
+
+/**
+ * \brief Bit follows empty / non-empty transitions
+ */
+TEST_F(RBUF_Set_Fixture, set_002)
+{
+  uint16_t id = 0;
+  RBUF_WriteUint8(&rbuf[150], 0xAA);
+  RBUF_WriteUint8(&rbuf[150], 0xBB);
+  ASSERT_TRUE(RBUF_SetFirstReady(&set, &id));
+  EXPECT_EQ(id, 150);
+  EXPECT_EQ(RBUF_SetGetRing(&set, id), &rbuf[150]);
+
+  RBUF_ReadUint8(&rbuf[150]);
+  EXPECT_TRUE(RBUF_SetFirstReady(&set, &id));
+  RBUF_ReadUint8(&rbuf[150]);
+  EXPECT_FALSE(RBUF_SetFirstReady(&set, &id));
+}
+
+/**
+ * \brief Round robin and priority order
+ */
+TEST_F(RBUF_Set_Fixture, set_003)
+{
+  uint16_t id = 0;
+  RBUF_WriteString(&rbuf[3], "a", 1);
+  RBUF_WriteString(&rbuf[40], "a", 1);
+  RBUF_WriteString(&rbuf[199], "a", 1);
+
+  EXPECT_TRUE(RBUF_SetNextReady(&set, &id));
+  EXPECT_EQ(id, 3);
+  EXPECT_TRUE(RBUF_SetNextReady(&set, &id));
+  EXPECT_EQ(id, 40);
+  EXPECT_TRUE(RBUF_SetNextReady(&set, &id));
+  EXPECT_EQ(id, 199);
+  EXPECT_TRUE(RBUF_SetNextReady(&set, &id));
+  EXPECT_EQ(id, 3);
+
+  EXPECT_TRUE(RBUF_SetFirstReady(&set, &id));
+  EXPECT_EQ(id, 3);
+}
+
+/**
+ * \brief Drain through block reads
+ */
+TEST_F(RBUF_Set_Fixture, set_004)
+{
+  uint16_t id = 0;
+  BUF_t buf;
+  std::uint8_t buf_data[DATA_SIZE];
+  BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+
+  RBUF_WriteString(&rbuf[64], "abc", 3);
+  ASSERT_TRUE(RBUF_SetNextReady(&set, &id));
+  EXPECT_EQ(RBUF_ReadCopyRaw(&buf, RBUF_SetGetRing(&set, id), DATA_SIZE), 3);
+  EXPECT_FALSE(RBUF_SetNextReady(&set, &id));
+}
+
+/**
+ * \brief Remove and add with data
+ */
+TEST_F(RBUF_Set_Fixture, set_005)
+{
+  uint16_t id = 0;
+  RBUF_WriteUint8(&rbuf[10], 0xAA);
+  RBUF_SetRemove(&set, 10);
+  EXPECT_FALSE(RBUF_SetFirstReady(&set, &id));
+  EXPECT_EQ(RBUF_SetGetRing(&set, 10), nullptr);
+  RBUF_WriteUint8(&rbuf[10], 0xBB);
+  EXPECT_FALSE(RBUF_SetFirstReady(&set, &id));
+
+  EXPECT_TRUE(RBUF_SetAdd(&set, &rbuf[10], 10));
+  EXPECT_TRUE(RBUF_SetFirstReady(&set, &id));
+  EXPECT_EQ(id, 10);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Set_Fixture, set_006)
+{
+  uint16_t id;
+  RBUF_t other;
+  EXPECT_FALSE(RBUF_SetAdd(&set, &other, 0));
+  EXPECT_FALSE(RBUF_SetAdd(&set, &other, RING_COUNT));
+  EXPECT_FALSE(RBUF_SetAdd(nullptr, &other, 0));
+  EXPECT_FALSE(RBUF_SetAdd(&set, nullptr, 0));
+  EXPECT_FALSE(RBUF_SetNextReady(nullptr, &id));
+  EXPECT_FALSE(RBUF_SetNextReady(&set, nullptr));
+  EXPECT_EQ(RBUF_SetGetRing(&set, RING_COUNT), nullptr);
+  RBUF_SetRemove(&set, RING_COUNT);
+}
@@ -0,0 +1,174 @@
+//! \file ut_rbuf_shm.cpp
+//! \brief Ring Buffer shared memory unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <csignal>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_shm.h"
+}
+
+using namespace testing;
+using testing::ElementsAreArray;
+
+class RBUF_Shm_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    fd = memfd_create("ut_rbuf_shm", 0);
+    ASSERT_GE(fd, 0);
+  }
+  void TearDown()
+  {
+    RBUF_ShmDetach(&producer);
+    RBUF_ShmDetach(&consumer);
+    close(fd);
+  }
+  // attributes
+  static constexpr uint8_t DATA_SIZE = 10;
+
+  int fd;
+  RBUF_Shm_t producer = {};
+  RBUF_Shm_t consumer = {};
+};
+
+/**
+ * \brief Create then attach a second mapping of the same region
+ */
+TEST_F(RBUF_Shm_Fixture, shm_001)
+{
+  ASSERT_TRUE(RBUF_ShmCreate(&producer, fd, DATA_SIZE));
+  ASSERT_TRUE(RBUF_ShmAttach(&consumer, fd));
+  EXPECT_NE(producer.base, consumer.base);
+  EXPECT_EQ(producer.map_size, RBUF_ShmGetRegionSize(DATA_SIZE));
+
+  std::string hello = "Hello";
+  EXPECT_TRUE(RBUF_ShmWriteString(&producer, hello.c_str(), hello.length()));
+  EXPECT_EQ(RBUF_ShmGetUsedSize(&consumer), hello.length());
+
+  BUF_t buf;
+  std::uint8_t buf_data[DATA_SIZE] = {};
+  BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+  EXPECT_EQ(RBUF_ShmReadCopyRaw(&buf, &consumer, DATA_SIZE), hello.length());
+  std::vector<std::uint8_t> expected = {'H', 'e', 'l', 'l', 'o'};
+  EXPECT_THAT(expected, ElementsAreArray(buf.data, hello.length()));
+  EXPECT_EQ(RBUF_ShmGetUsedSize(&producer), 0);
+  EXPECT_EQ(RBUF_ShmGetFreeSize(&producer), DATA_SIZE - 1);
+}
+
+/**
+ * \brief Attach rejects a region without valid header
+ */
+TEST_F(RBUF_Shm_Fixture, shm_002)
+{
+  EXPECT_FALSE(RBUF_ShmAttach(&consumer, fd));
+  ASSERT_EQ(ftruncate(fd, RBUF_ShmGetRegionSize(DATA_SIZE)), 0);
+  EXPECT_FALSE(RBUF_ShmAttach(&consumer, fd));
+  EXPECT_EQ(consumer.base, nullptr);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Shm_Fixture, shm_003)
+{
+  EXPECT_FALSE(RBUF_ShmCreate(nullptr, fd, DATA_SIZE));
+  EXPECT_FALSE(RBUF_ShmCreate(&producer, -1, DATA_SIZE));
+  EXPECT_FALSE(RBUF_ShmCreate(&producer, fd, 0));
+  EXPECT_FALSE(RBUF_ShmAttach(nullptr, fd));
+  EXPECT_FALSE(RBUF_ShmWriteString(&producer, "a", 1));
+  EXPECT_EQ(RBUF_ShmReadCopyRaw(nullptr, &producer, 1), 0);
+  EXPECT_EQ(RBUF_ShmGetUsedSize(nullptr), 0);
+}
+
+/**
+ * \brief Producer in a child process, consumer in the parent, data wraps around
+ */
+TEST_F(RBUF_Shm_Fixture, shm_004)
+{
+  static constexpr int COUNT = 1000;
+  ASSERT_TRUE(RBUF_ShmCreate(&consumer, fd, DATA_SIZE));
+
+  pid_t pid = fork();
+  ASSERT_GE(pid, 0);
+  if (pid == 0)
+  {
+    RBUF_Shm_t child = {};
+    bool ok = RBUF_ShmAttach(&child, fd);
+    for (int i = 0; ok && (i < COUNT); i++)
+    {
+      char c = (char) i;
+      while (RBUF_ShmWriteString(&child, &c, 1) == false)
+      {}
+    }
+    _exit(ok ? 0 : 1);
+  }
+
+  int received = 0;
+  bool in_order = true;
+  bool exited = false;
+  int status = 0;
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+  while ((received < COUNT) && (std::chrono::steady_clock::now() < deadline))
+  {
+    BUF_t buf;
+    std::uint8_t buf_data[DATA_SIZE] = {};
+    BUF_InitEmpty(&buf, buf_data, DATA_SIZE);
+    RBUF_size_t read = RBUF_ShmReadCopyRaw(&buf, &consumer, DATA_SIZE);
+    for (RBUF_size_t i = 0; i < read; i++)
+    {
+      in_order &= (buf_data[i] == (std::uint8_t) received);
+      received++;
+    }
+    if ((read == 0U) && (exited == true)) /* Child gone and ring drained */
+    {
+      break;
+    }
+    if ((read == 0U) && (exited == false))
+    {
+      exited = (waitpid(pid, &status, WNOHANG) == pid);
+    }
+  }
+  if (exited == false)
+  {
+    if (received < COUNT) /* Timed out, child stuck */
+    {
+      kill(pid, SIGKILL);
+    }
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+  }
+  EXPECT_EQ(received, COUNT);
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(WEXITSTATUS(status), 0);
+  EXPECT_TRUE(in_order);
+}
+
+/**
+ * \brief Named POSIX shared memory object
+ */
+TEST_F(RBUF_Shm_Fixture, shm_005)
+{
+  const char *name = "/ut_rbuf_shm_005";
+  int named_fd = shm_open(name, O_CREAT | O_RDWR, 0600);
+  ASSERT_GE(named_fd, 0);
+  EXPECT_TRUE(RBUF_ShmCreate(&producer, named_fd, DATA_SIZE));
+  close(named_fd);
+
+  named_fd = shm_open(name, O_RDWR, 0600);
+  ASSERT_GE(named_fd, 0);
+  EXPECT_TRUE(RBUF_ShmAttach(&consumer, named_fd));
+  close(named_fd);
+  shm_unlink(name);
+
+  EXPECT_TRUE(RBUF_ShmWriteString(&producer, "ab", 2));
+  EXPECT_EQ(RBUF_ShmGetUsedSize(&consumer), 2);
+}
@@ -0,0 +1,156 @@
+//! \file ut_rbuf_ts.cpp
+//! \brief Timestamped record Ring Buffer unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_ts.h"
+}
+
+using namespace testing;
+
+class RBUF_Ts_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_TsInit(&ts, data, sizeof(data), PAYLOAD_SIZE);
+  }
+
+  void Push(uint32_t timestamp)
+  {
+    uint16_t sample = (uint16_t) (timestamp * 10U);
+    ASSERT_TRUE(RBUF_TsPush(&ts, timestamp, (const uint8_t *) &sample));
+  }
+  // attributes
+  static constexpr uint8_t PAYLOAD_SIZE = 2;
+  static constexpr uint8_t CAPACITY     = 8;
+
+  RBUF_Ts_t ts;
+  std::uint8_t data[CAPACITY * RBUF_TS_RECORD_SIZE(PAYLOAD_SIZE)];
+};
+
+/**
+ * \brief Push and access in logical order
+ */
+TEST_F(RBUF_Ts_Fixture, ts_001)
+{
+  EXPECT_EQ(ts.capacity, CAPACITY);
+  Push(100);
+  Push(200);
+  EXPECT_EQ(RBUF_TsGetCount(&ts), 2);
+  EXPECT_EQ(RBUF_TsGetTimestamp(RBUF_TsGetRecord(&ts, 0)), 100U);
+  EXPECT_EQ(RBUF_TsGetTimestamp(RBUF_TsGetRecord(&ts, 1)), 200U);
+  EXPECT_EQ(RBUF_TsGetRecord(&ts, 2), nullptr);
+
+  uint16_t sample = 0;
+  memcpy(&sample, RBUF_TsGetRecord(&ts, 1) + RBUF_TS_TIMESTAMP_SIZE, sizeof(sample));
+  EXPECT_EQ(sample, 2000);
+
+  /* Timestamps must not go backward */
+  uint16_t payload = 0;
+  EXPECT_FALSE(RBUF_TsPush(&ts, 150, (const uint8_t *) &payload));
+  EXPECT_TRUE(RBUF_TsPush(&ts, 200, (const uint8_t *) &payload));
+}
+
+/**
+ * \brief Window query without rollover
+ */
+TEST_F(RBUF_Ts_Fixture, ts_002)
+{
+  RBUF_Span_t spans[2];
+  for (uint32_t t = 1; t <= 6; t++)
+  {
+    Push(t * 10);
+  }
+
+  EXPECT_EQ(RBUF_TsQuery(&ts, 15, 45, spans), 3);
+  EXPECT_EQ(RBUF_TsGetTimestamp(spans[0].data), 20U);
+  EXPECT_EQ(spans[0].size, 3 * ts.record_size);
+  EXPECT_EQ(spans[1].size, 0);
+
+  EXPECT_EQ(RBUF_TsQuery(&ts, 20, 40, spans), 3);
+  EXPECT_EQ(RBUF_TsQuery(&ts, 0, 1000, spans), 6);
+  EXPECT_EQ(RBUF_TsQuery(&ts, 61, 1000, spans), 0);
+  EXPECT_EQ(spans[0].data, nullptr);
+  EXPECT_EQ(RBUF_TsQuery(&ts, 40, 20, spans), 0);
+}
+
+/**
+ * \brief Window query across rollover, oldest records overwritten
+ */
+TEST_F(RBUF_Ts_Fixture, ts_003)
+{
+  RBUF_Span_t spans[2];
+  for (uint32_t t = 1; t <= 12; t++)
+  {
+    Push(t * 10);
+  }
+  EXPECT_EQ(RBUF_TsGetCount(&ts), CAPACITY);
+  EXPECT_EQ(RBUF_TsGetTimestamp(RBUF_TsGetRecord(&ts, 0)), 50U);
+
+  EXPECT_EQ(RBUF_TsQuery(&ts, 60, 110, spans), 6);
+  EXPECT_EQ(RBUF_TsGetTimestamp(spans[0].data), 60U);
+  EXPECT_EQ(spans[0].size, 3 * ts.record_size);
+  EXPECT_EQ(spans[1].data, data);
+  EXPECT_EQ(RBUF_TsGetTimestamp(spans[1].data), 90U);
+  EXPECT_EQ(spans[1].size, 3 * ts.record_size);
+
+  EXPECT_TRUE(RBUF_TsPop(&ts));
+  EXPECT_EQ(RBUF_TsQuery(&ts, 0, 55, spans), 0);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Ts_Fixture, ts_004)
+{
+  RBUF_Span_t spans[2];
+  uint16_t payload = 0;
+  EXPECT_FALSE(RBUF_TsPush(nullptr, 0, (const uint8_t *) &payload));
+  EXPECT_FALSE(RBUF_TsPush(&ts, 0, nullptr));
+  EXPECT_FALSE(RBUF_TsPop(&ts));
+  EXPECT_EQ(RBUF_TsQuery(nullptr, 0, 1, spans), 0);
+  EXPECT_EQ(RBUF_TsQuery(&ts, 0, 1, nullptr), 0);
+  EXPECT_EQ(RBUF_TsGetTimestamp(nullptr), 0U);
+
+  RBUF_TsInit(&ts, nullptr, sizeof(data), PAYLOAD_SIZE);
+  EXPECT_FALSE(RBUF_TsPush(&ts, 0, (const uint8_t *) &payload));
+}
+
+/**
+ * \brief Pushes and queries keep working across the tick counter wrap
+ */
+TEST_F(RBUF_Ts_Fixture, ts_005)
+{
+  RBUF_Span_t spans[2];
+
+  Push(0xFFFFFFF0U);
+  Push(0xFFFFFFFFU);
+  Push(0x00000005U);
+  Push(0x00000010U);
+  EXPECT_FALSE(RBUF_TsPush(&ts, 0xFFFFFFF8U, data));
+  EXPECT_EQ(RBUF_TsGetCount(&ts), 4U);
+
+  EXPECT_EQ(RBUF_TsQuery(&ts, 0xFFFFFFF8U, 0x00000008U, spans), 2U);
+  EXPECT_EQ(RBUF_TsGetTimestamp(spans[0].data), 0xFFFFFFFFU);
+  EXPECT_EQ(RBUF_TsQuery(&ts, 0x00000006U, 0x00000020U, spans), 1U);
+  EXPECT_EQ(RBUF_TsGetTimestamp(spans[0].data), 0x00000010U);
+}
+
+/**
+ * \brief Record size overflowing the storage size gives an empty capacity
+ */
+TEST_F(RBUF_Ts_Fixture, ts_006)
+{
+  RBUF_TsInit(&ts, data, sizeof(data), (RBUF_size_t) (0U - RBUF_TS_TIMESTAMP_SIZE));
+  EXPECT_EQ(ts.capacity, 0U);
+  EXPECT_FALSE(RBUF_TsPush(&ts, 1U, data));
+
+  RBUF_TsInit(&ts, data, sizeof(data), sizeof(data));
+  EXPECT_EQ(ts.capacity, 0U);
+  RBUF_TsInit(&ts, data, sizeof(data), sizeof(data) - RBUF_TS_TIMESTAMP_SIZE);
+  EXPECT_EQ(ts.capacity, 1U);
+}
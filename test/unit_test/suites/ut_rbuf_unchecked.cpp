@@ -0,0 +1,113 @@
+//! \file ut_rbuf_unchecked.cpp
+//! \brief Unchecked inline Ring Buffer fast path unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_set.h"
+#include "ring_buffer/ring_buffer_unchecked.h"
+}
+
+using namespace testing;
+
+class RBUF_Unchecked_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, sizeof(data));
+  }
+  // attributes
+  RBUF_t rbuf;
+  std::uint8_t data[8];
+};
+
+/**
+ * \brief Byte push and pop across rollover, until full and empty
+ */
+TEST_F(RBUF_Unchecked_Fixture, unchecked_001)
+{
+  uint8_t value = 0;
+
+  for (int round = 0; round < 3; round++)
+  {
+    for (uint8_t i = 0; i < 7; i++)
+    {
+      EXPECT_TRUE(RBUF_UncheckedWriteUint8(&rbuf, i));
+    }
+    EXPECT_FALSE(RBUF_UncheckedWriteUint8(&rbuf, 7));
+    EXPECT_EQ(RBUF_UncheckedGetUsedSize(&rbuf), RBUF_GetUsedSize(&rbuf));
+    EXPECT_EQ(RBUF_UncheckedGetFreeSize(&rbuf), 0);
+
+    for (uint8_t i = 0; i < 5; i++)
+    {
+      EXPECT_TRUE(RBUF_UncheckedReadUint8(&rbuf, &value));
+      EXPECT_EQ(value, i);
+    }
+    EXPECT_EQ(RBUF_ReadUint8(&rbuf), 5);
+    EXPECT_EQ(RBUF_ReadUint8(&rbuf), 6);
+    EXPECT_TRUE(RBUF_UncheckedIsEmpty(&rbuf));
+    EXPECT_FALSE(RBUF_UncheckedReadUint8(&rbuf, &value));
+    EXPECT_EQ(RBUF_UncheckedGetFreeSize(&rbuf), RBUF_GetFreeSize(&rbuf));
+  }
+}
+
+/**
+ * \brief Block write and read across rollover
+ */
+TEST_F(RBUF_Unchecked_Fixture, unchecked_002)
+{
+  char text[8] = {};
+
+  EXPECT_TRUE(RBUF_UncheckedWriteString(&rbuf, "abcde", 5));
+  EXPECT_TRUE(RBUF_UncheckedReadString(&rbuf, text, 4));
+  EXPECT_STREQ(text, "abcd");
+
+  EXPECT_TRUE(RBUF_UncheckedWriteString(&rbuf, "fghijk", 6));
+  EXPECT_FALSE(RBUF_UncheckedWriteString(&rbuf, "l", 1));
+  EXPECT_FALSE(RBUF_UncheckedReadString(&rbuf, text, 8));
+  EXPECT_TRUE(RBUF_UncheckedReadString(&rbuf, text, 7));
+  EXPECT_STREQ(text, "efghijk");
+  EXPECT_TRUE(RBUF_UncheckedIsEmpty(&rbuf));
+}
+
+/**
+ * \brief Ring set readiness follows unchecked writes and reads
+ */
+TEST_F(RBUF_Unchecked_Fixture, unchecked_003)
+{
+  RBUF_t *rings[1];
+  uint32_t ready[RBUF_SET_WORDS(1)];
+  RBUF_Set_t set;
+  uint16_t id = 0;
+  uint8_t value = 0;
+
+  RBUF_SetInit(&set, rings, ready, 1);
+  EXPECT_TRUE(RBUF_SetAdd(&set, &rbuf, 0));
+  EXPECT_FALSE(RBUF_SetFirstReady(&set, &id));
+  EXPECT_TRUE(RBUF_UncheckedWriteUint8(&rbuf, 1));
+  EXPECT_TRUE(RBUF_SetFirstReady(&set, &id));
+  EXPECT_TRUE(RBUF_UncheckedReadUint8(&rbuf, &value));
+  EXPECT_FALSE(RBUF_SetFirstReady(&set, &id));
+}
+
+/**
+ * \brief Bad input parameters, caught by assertions in debug builds
+ */
+TEST_F(RBUF_Unchecked_Fixture, unchecked_004)
+{
+#ifndef NDEBUG
+  uint8_t value = 0;
+  RBUF_t invalid;
+  RBUF_InitEmpty(&invalid, nullptr, 8);
+
+  EXPECT_DEATH(RBUF_UncheckedWriteUint8(nullptr, 1), "");
+  EXPECT_DEATH(RBUF_UncheckedWriteUint8(&invalid, 1), "");
+  EXPECT_DEATH(RBUF_UncheckedReadUint8(&rbuf, nullptr), "");
+  EXPECT_DEATH(RBUF_UncheckedReadUint8(&invalid, &value), "");
+#else
+  GTEST_SKIP() << "Assertions compiled out";
+#endif
+}
@@ -0,0 +1,240 @@
+//! \file ut_rbuf_uring.cpp
+//! \brief Ring Buffer io_uring filling and draining unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gmock/gmock.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_uring.h"
+}
+
+using namespace testing;
+using testing::ElementsAreArray;
+
+class RBUF_Uring_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    if (RBUF_UringInit(&uring, 8) == false)
+    {
+      GTEST_SKIP() << "io_uring not available";
+    }
+    RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+    snprintf(path, sizeof(path), "/tmp/ut_rbuf_uring_%d.bin", (int) getpid());
+  }
+  void TearDown()
+  {
+    RBUF_UringDestroy(&uring);
+    for (int fd : fds)
+    {
+      close(fd);
+    }
+    unlink(path);
+  }
+
+  /**
+   * \brief Create file holding payload, opened for reading
+   */
+  int OpenFile(const std::vector<std::uint8_t> &payload)
+  {
+    int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    EXPECT_EQ(write(fd, payload.data(), payload.size()), (ssize_t) payload.size());
+    fds.push_back(fd);
+    return fd;
+  }
+
+  void SocketPair(int pair[2])
+  {
+    ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, pair), 0);
+    fds.push_back(pair[0]);
+    fds.push_back(pair[1]);
+  }
+
+  /**
+   * \brief Move empty ring indices close to the end so the next transfer wraps
+   */
+  void MoveToEnd(RBUF_t *ring, RBUF_size_t offset)
+  {
+    ring->write_index = ring->size - offset;
+    ring->read_index  = ring->size - offset;
+  }
+
+  std::vector<std::uint8_t> ReadRing(RBUF_t *ring)
+  {
+    std::vector<std::uint8_t> bytes;
+    while (RBUF_IsEmpty(ring) == false)
+    {
+      bytes.push_back(RBUF_ReadUint8(ring));
+    }
+    return bytes;
+  }
+  // attributes
+  static constexpr uint8_t DATA_SIZE = 16;
+
+  RBUF_Uring_t uring = {};
+  RBUF_t rbuf;
+  std::uint8_t data[DATA_SIZE];
+  char path[64];
+  std::vector<int> fds;
+};
+
+/**
+ * \brief Fill from file into both spans, offset advanced, then end of file
+ */
+TEST_F(RBUF_Uring_Fixture, uring_001)
+{
+  std::vector<std::uint8_t> payload = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  RBUF_UringStream_t stream;
+
+  MoveToEnd(&rbuf, 4);
+  RBUF_UringStreamInit(&stream, &rbuf, OpenFile(payload), RBUF_URING_FILL, 0);
+  EXPECT_TRUE(RBUF_UringQueue(&uring, &stream));
+  EXPECT_FALSE(RBUF_UringQueue(&uring, &stream));
+  EXPECT_EQ(RBUF_UringSubmit(&uring, 1), 1);
+  EXPECT_FALSE(stream.busy);
+  EXPECT_EQ(stream.offset, payload.size());
+  EXPECT_EQ(stream.bytes, payload.size());
+  EXPECT_THAT(ReadRing(&rbuf), ElementsAreArray(payload));
+
+  EXPECT_TRUE(RBUF_UringQueue(&uring, &stream));
+  EXPECT_EQ(RBUF_UringSubmit(&uring, 1), 1);
+  EXPECT_TRUE(stream.eof);
+  EXPECT_FALSE(RBUF_UringQueue(&uring, &stream));
+}
+
+/**
+ * \brief Drain ring data across rollover to a socket
+ */
+TEST_F(RBUF_Uring_Fixture, uring_002)
+{
+  std::vector<std::uint8_t> payload = {'r', 'o', 'l', 'l', 'o', 'v', 'e', 'r'};
+  RBUF_UringStream_t stream;
+  int pair[2];
+  std::uint8_t received[DATA_SIZE] = {};
+
+  SocketPair(pair);
+  MoveToEnd(&rbuf, 3);
+  RBUF_WriteString(&rbuf, (const char *) payload.data(), (RBUF_size_t) payload.size());
+  RBUF_UringStreamInit(&stream, &rbuf, pair[0], RBUF_URING_DRAIN, RBUF_URING_OFFSET_NONE);
+  EXPECT_TRUE(RBUF_UringQueue(&uring, &stream));
+  EXPECT_EQ(RBUF_UringSubmit(&uring, 1), 1);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+  EXPECT_FALSE(RBUF_UringQueue(&uring, &stream));
+
+  EXPECT_EQ(read(pair[1], received, sizeof(received)), (ssize_t) payload.size());
+  EXPECT_THAT(payload, ElementsAreArray(received, payload.size()));
+}
+
+/**
+ * \brief Streams share one instance, one submission serves them all
+ */
+TEST_F(RBUF_Uring_Fixture, uring_003)
+{
+  static constexpr int STREAM_COUNT = 4;
+  RBUF_t rings[STREAM_COUNT];
+  std::uint8_t storage[STREAM_COUNT][DATA_SIZE];
+  RBUF_UringStream_t streams[STREAM_COUNT];
+
+  for (int i = 0; i < STREAM_COUNT; i++)
+  {
+    int pair[2];
+    std::uint8_t byte = (std::uint8_t) (0x10 + i);
+
+    SocketPair(pair);
+    RBUF_InitEmpty(&rings[i], storage[i], DATA_SIZE);
+    RBUF_UringStreamInit(&streams[i], &rings[i], pair[0], RBUF_URING_FILL, RBUF_URING_OFFSET_NONE);
+    EXPECT_EQ(write(pair[1], &byte, 1), 1);
+    EXPECT_TRUE(RBUF_UringQueue(&uring, &streams[i]));
+  }
+  int completed = 0;
+  while (completed < STREAM_COUNT)
+  {
+    int result = RBUF_UringSubmit(&uring, STREAM_COUNT - completed);
+    ASSERT_GE(result, 0);
+    completed += result;
+  }
+  for (int i = 0; i < STREAM_COUNT; i++)
+  {
+    EXPECT_THAT(ReadRing(&rings[i]), ElementsAre(0x10 + i));
+  }
+}
+
+/**
+ * \brief Registered storage, fixed buffer transfers one span at a time
+ */
+TEST_F(RBUF_Uring_Fixture, uring_004)
+{
+  std::vector<std::uint8_t> payload = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+  RBUF_UringStream_t stream;
+  RBUF_UringStream_t *streams[] = {&stream};
+
+  MoveToEnd(&rbuf, 4);
+  RBUF_UringStreamInit(&stream, &rbuf, OpenFile(payload), RBUF_URING_FILL, 0);
+  if (RBUF_UringRegister(&uring, streams, 1) == false)
+  {
+    GTEST_SKIP() << "Fixed buffers not available";
+  }
+  EXPECT_EQ(stream.buffer_index, 0);
+  EXPECT_FALSE(RBUF_UringRegister(&uring, streams, 1));
+
+  EXPECT_TRUE(RBUF_UringQueue(&uring, &stream));
+  EXPECT_EQ(RBUF_UringSubmit(&uring, 1), 1);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 4);
+  EXPECT_TRUE(RBUF_UringQueue(&uring, &stream));
+  EXPECT_EQ(RBUF_UringSubmit(&uring, 1), 1);
+  EXPECT_THAT(ReadRing(&rbuf), ElementsAreArray(payload));
+}
+
+/**
+ * \brief Failed transfer reports errno, ring unchanged; full ring queues nothing
+ */
+TEST_F(RBUF_Uring_Fixture, uring_005)
+{
+  RBUF_UringStream_t stream;
+  int pair[2];
+
+  SocketPair(pair);
+  close(pair[0]);
+  fds.erase(fds.begin());
+  RBUF_UringStreamInit(&stream, &rbuf, pair[0], RBUF_URING_FILL, RBUF_URING_OFFSET_NONE);
+  EXPECT_TRUE(RBUF_UringQueue(&uring, &stream));
+  EXPECT_EQ(RBUF_UringSubmit(&uring, 1), 1);
+  EXPECT_EQ(stream.error, -EBADF);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+
+  rbuf.write_index = DATA_SIZE - 1;
+  RBUF_UringStreamInit(&stream, &rbuf, pair[1], RBUF_URING_FILL, RBUF_URING_OFFSET_NONE);
+  EXPECT_FALSE(RBUF_UringQueue(&uring, &stream));
+  EXPECT_EQ(RBUF_UringSubmit(&uring, 0), 0);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Uring_Fixture, uring_006)
+{
+  RBUF_UringStream_t stream;
+  RBUF_UringStream_t *streams[] = {nullptr};
+  RBUF_Uring_t closed = {};
+
+  RBUF_UringStreamInit(&stream, &rbuf, 0, RBUF_URING_FILL, 0);
+  EXPECT_FALSE(RBUF_UringInit(nullptr, 8));
+  EXPECT_FALSE(RBUF_UringInit(&closed, 0));
+  EXPECT_FALSE(RBUF_UringQueue(&closed, &stream));
+  EXPECT_FALSE(RBUF_UringQueue(nullptr, &stream));
+  EXPECT_FALSE(RBUF_UringQueue(&uring, nullptr));
+  EXPECT_EQ(RBUF_UringSubmit(nullptr, 0), -EINVAL);
+  EXPECT_FALSE(RBUF_UringRegister(&uring, nullptr, 1));
+  EXPECT_FALSE(RBUF_UringRegister(&uring, streams, 1));
+  EXPECT_FALSE(RBUF_UringRegister(&uring, streams, 0));
+  RBUF_UringDestroy(nullptr);
+  RBUF_UringDestroy(&closed);
+}
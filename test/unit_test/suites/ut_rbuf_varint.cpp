@@ -0,0 +1,152 @@
+//! \file ut_rbuf_varint.cpp
+//! \brief Ring Buffer varint unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <gmock/gmock.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_varint.h"
+}
+
+using namespace testing;
+using testing::ElementsAreArray;
+
+class RBUF_Varint_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+  }
+  // attributes
+  RBUF_t rbuf;
+  static constexpr uint8_t DATA_SIZE = 10;
+  std::uint8_t data[DATA_SIZE];
+};
+
+/**
+ * \brief Encoded sizes and bytes
+ */
+TEST_F(RBUF_Varint_Fixture, varint_001)
+{
+  EXPECT_EQ(RBUF_VarintGetSize(0), 1);
+  EXPECT_EQ(RBUF_VarintGetSize(127), 1);
+  EXPECT_EQ(RBUF_VarintGetSize(128), 2);
+  EXPECT_EQ(RBUF_VarintGetSize(16383), 2);
+  EXPECT_EQ(RBUF_VarintGetSize(UINT32_MAX), RBUF_VARINT_SIZE_MAX);
+
+  EXPECT_TRUE(RBUF_WriteVarint(&rbuf, 300));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 2);
+  EXPECT_THAT(std::vector<std::uint8_t>({0xAC, 0x02}), ElementsAreArray(rbuf.data, 2));
+}
+
+/**
+ * \brief Round trip across rollover
+ */
+TEST_F(RBUF_Varint_Fixture, varint_002)
+{
+  rbuf.write_index = DATA_SIZE - 2;
+  rbuf.read_index  = DATA_SIZE - 2;
+
+  uint32_t value = 0;
+  EXPECT_TRUE(RBUF_WriteVarint(&rbuf, UINT32_MAX));
+  EXPECT_EQ(rbuf.write_index, 3);
+  EXPECT_EQ(RBUF_ReadVarint(&rbuf, &value), RBUF_VARINT_OK);
+  EXPECT_EQ(value, UINT32_MAX);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
+
+/**
+ * \brief Zigzag signed values
+ */
+TEST_F(RBUF_Varint_Fixture, varint_003)
+{
+  const int32_t values[] = {0, -1, 1, -64, INT32_MIN, INT32_MAX};
+  for (int32_t value : values)
+  {
+    int32_t read = 0;
+    ASSERT_TRUE(RBUF_WriteVarintSigned(&rbuf, value));
+    ASSERT_EQ(RBUF_ReadVarintSigned(&rbuf, &read), RBUF_VARINT_OK);
+    EXPECT_EQ(read, value);
+  }
+  RBUF_WriteVarintSigned(&rbuf, -1);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 1);
+}
+
+/**
+ * \brief Incomplete value is not consumed
+ */
+TEST_F(RBUF_Varint_Fixture, varint_004)
+{
+  uint32_t value = 0;
+  uint8_t size   = 0;
+  EXPECT_EQ(RBUF_ReadVarint(&rbuf, &value), RBUF_VARINT_INCOMPLETE);
+
+  RBUF_WriteUint8(&rbuf, 0xAC);
+  EXPECT_EQ(RBUF_PeekVarint(&rbuf, &value, &size), RBUF_VARINT_INCOMPLETE);
+  EXPECT_EQ(RBUF_ReadVarint(&rbuf, &value), RBUF_VARINT_INCOMPLETE);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 1);
+
+  RBUF_WriteUint8(&rbuf, 0x02);
+  EXPECT_EQ(RBUF_PeekVarint(&rbuf, &value, &size), RBUF_VARINT_OK);
+  EXPECT_EQ(value, 300U);
+  EXPECT_EQ(size, 2);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 2);
+}
+
+/**
+ * \brief Not enough room and malformed value
+ */
+TEST_F(RBUF_Varint_Fixture, varint_005)
+{
+  uint32_t value = 0;
+  EXPECT_TRUE(RBUF_WriteVarint(&rbuf, UINT32_MAX));
+  EXPECT_FALSE(RBUF_WriteVarint(&rbuf, UINT32_MAX));
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 5);
+
+  RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+  RBUF_WriteString(&rbuf, "\xFF\xFF\xFF\xFF\x10", 5);
+  EXPECT_EQ(RBUF_ReadVarint(&rbuf, &value), RBUF_VARINT_INVALID);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf)); /* Malformed bytes consumed */
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Varint_Fixture, varint_006)
+{
+  uint32_t value;
+  int32_t signed_value;
+  EXPECT_FALSE(RBUF_WriteVarint(nullptr, 1));
+  EXPECT_EQ(RBUF_ReadVarint(nullptr, &value), RBUF_VARINT_INVALID);
+  EXPECT_EQ(RBUF_ReadVarint(&rbuf, nullptr), RBUF_VARINT_INVALID);
+  EXPECT_EQ(RBUF_ReadVarintSigned(&rbuf, nullptr), RBUF_VARINT_INVALID);
+  EXPECT_EQ(RBUF_ReadVarintSigned(nullptr, &signed_value), RBUF_VARINT_INVALID);
+}
+
+/**
+ * \brief Malformed value is skipped, stream resumes on the next one
+ */
+TEST_F(RBUF_Varint_Fixture, varint_007)
+{
+  uint32_t value = 0;
+  int32_t signed_value = 0;
+  uint8_t size = 0;
+
+  RBUF_WriteString(&rbuf, "\x80\x80\x80\x80\x20", 5);
+  EXPECT_TRUE(RBUF_WriteVarint(&rbuf, 300));
+  EXPECT_EQ(RBUF_PeekVarint(&rbuf, &value, &size), RBUF_VARINT_INVALID);
+  EXPECT_EQ(size, RBUF_VARINT_SIZE_MAX);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 7);
+  EXPECT_EQ(RBUF_ReadVarint(&rbuf, &value), RBUF_VARINT_INVALID);
+  EXPECT_EQ(RBUF_ReadVarint(&rbuf, &value), RBUF_VARINT_OK);
+  EXPECT_EQ(value, 300U);
+
+  RBUF_WriteString(&rbuf, "\xFF\xFF\xFF\xFF\xFF", 5);
+  EXPECT_TRUE(RBUF_WriteVarintSigned(&rbuf, -3));
+  EXPECT_EQ(RBUF_ReadVarintSigned(&rbuf, &signed_value), RBUF_VARINT_INVALID);
+  EXPECT_EQ(RBUF_ReadVarintSigned(&rbuf, &signed_value), RBUF_VARINT_OK);
+  EXPECT_EQ(signed_value, -3);
+  EXPECT_TRUE(RBUF_IsEmpty(&rbuf));
+}
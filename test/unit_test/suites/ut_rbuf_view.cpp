@@ -0,0 +1,156 @@
+//! \file ut_rbuf_view.cpp
+//! \brief Ring Buffer STL view unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
+#include <gmock/gmock.h>
+
+#include "ring_buffer/ring_buffer_view.hpp"
+
+using namespace testing;
+using testing::ElementsAreArray;
+
+class RBUF_View_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, DATA_SIZE);
+  }
+
+  /**
+   * \brief Write bytes starting offset bytes before the end of storage
+   */
+  void WriteWrapped(const std::vector<std::uint8_t> &bytes, RBUF_size_t offset)
+  {
+    rbuf.write_index = DATA_SIZE - offset;
+    rbuf.read_index  = DATA_SIZE - offset;
+    RBUF_WriteString(&rbuf, (const char *) bytes.data(), (RBUF_size_t) bytes.size());
+  }
+  // attributes
+  static constexpr uint8_t DATA_SIZE = 16;
+
+  RBUF_t rbuf;
+  std::uint8_t data[DATA_SIZE];
+  std::vector<std::uint8_t> bytes = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+};
+
+/**
+ * \brief Standard algorithms over wrapped contents through random access iterators
+ */
+TEST_F(RBUF_View_Fixture, view_001)
+{
+  WriteWrapped(bytes, 4);
+  rbuf::View view(rbuf);
+
+  EXPECT_EQ(view.size(), bytes.size());
+  EXPECT_FALSE(view.empty());
+  EXPECT_TRUE(std::equal(view.begin(), view.end(), bytes.begin(), bytes.end()));
+  EXPECT_EQ(std::accumulate(view.begin(), view.end(), 0), 55);
+  EXPECT_EQ(std::find(view.begin(), view.end(), 6) - view.begin(), 5);
+  EXPECT_EQ(std::count_if(view.begin(), view.end(), [](std::uint8_t b) { return (b % 2U) == 0U; }), 5);
+  EXPECT_TRUE(std::is_sorted(view.begin(), view.end()));
+  EXPECT_TRUE(std::binary_search(view.begin(), view.end(), 9));
+
+  std::vector<std::uint8_t> reversed(view.size());
+  std::reverse_copy(view.begin(), view.end(), reversed.begin());
+  EXPECT_EQ(reversed.front(), 10);
+  EXPECT_EQ(reversed.back(), 1);
+}
+
+/**
+ * \brief Iterator arithmetic and random access across rollover
+ */
+TEST_F(RBUF_View_Fixture, view_002)
+{
+  WriteWrapped(bytes, 4);
+  rbuf::View view(rbuf);
+  rbuf::View::Iterator it = view.begin();
+
+  EXPECT_EQ(view[3], 4);
+  EXPECT_EQ(view[4], 5);
+  EXPECT_EQ(it[9], 10);
+  it += 4;
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(*(it - 1), 4);
+  EXPECT_EQ(*(2 + it), 7);
+  EXPECT_EQ(*--it, 4);
+  EXPECT_EQ(*it++, 4);
+  EXPECT_EQ(it.Position(), 4U);
+  EXPECT_EQ(view.end() - it, 6);
+  EXPECT_TRUE(it < view.end());
+  EXPECT_TRUE(view.begin() <= it);
+  EXPECT_TRUE(view.end() > it);
+  EXPECT_EQ(rbuf::View::Iterator(), rbuf::View::Iterator());
+}
+
+/**
+ * \brief Segments expose both contiguous parts, segmented algorithms match iterator ones
+ */
+TEST_F(RBUF_View_Fixture, view_003)
+{
+  WriteWrapped(bytes, 4);
+  rbuf::View view(rbuf);
+
+  EXPECT_EQ(view.Segments()[0].data, &data[DATA_SIZE - 4]);
+  EXPECT_EQ(view.Segments()[0].size, 4U);
+  EXPECT_EQ(view.Segments()[1].data, &data[0]);
+  EXPECT_EQ(view.Segments()[1].size, 6U);
+
+  int calls = 0;
+  view.ForEachSegment([&calls](const std::uint8_t *first, const std::uint8_t *last) {
+    EXPECT_LT(first, last);
+    calls++;
+  });
+  EXPECT_EQ(calls, 2);
+
+  EXPECT_EQ(view.Accumulate(0), 55);
+  EXPECT_EQ(view.Accumulate(1, std::multiplies<>()), 3628800);
+  EXPECT_EQ(view.Find(3).Position(), 2U);
+  EXPECT_EQ(view.Find(7).Position(), 6U);
+  EXPECT_EQ(view.Find(42), view.end());
+
+  std::vector<std::uint8_t> copied;
+  view.CopyTo(std::back_inserter(copied));
+  EXPECT_THAT(copied, ElementsAreArray(bytes));
+}
+
+/**
+ * \brief Consume through the view position, view is a snapshot
+ */
+TEST_F(RBUF_View_Fixture, view_004)
+{
+  WriteWrapped(bytes, 2);
+  rbuf::View view(rbuf);
+
+  EXPECT_EQ(view.Segments()[1].size, 8U);
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, (RBUF_size_t) view.Find(5).Position()));
+  EXPECT_EQ(RBUF_ReadUint8(&rbuf), 5);
+  EXPECT_EQ(view.size(), bytes.size());
+
+  rbuf::View rest(rbuf);
+  EXPECT_EQ(rest.size(), 5U);
+  EXPECT_EQ(rest.Segments()[1].size, 0U);
+  EXPECT_EQ(rest.Accumulate(0), 40);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_View_Fixture, view_005)
+{
+  RBUF_t uninitialized = {};
+  rbuf::View empty(rbuf);
+  rbuf::View invalid(uninitialized);
+
+  EXPECT_TRUE(empty.empty());
+  EXPECT_EQ(empty.begin(), empty.end());
+  EXPECT_EQ(empty.Accumulate(0), 0);
+  EXPECT_EQ(empty.Find(0), empty.end());
+  EXPECT_TRUE(invalid.empty());
+  EXPECT_EQ(invalid.Segments()[0].data, nullptr);
+}
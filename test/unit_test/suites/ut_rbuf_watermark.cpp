@@ -0,0 +1,159 @@
+//! \file ut_rbuf_watermark.cpp
+//! \brief Ring Buffer watermark callbacks unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer.h"
+#include "ring_buffer/ring_buffer_unchecked.h"
+}
+
+using namespace testing;
+
+namespace
+{
+
+void Record(RBUF_t *buffer, RBUF_WatermarkEvent_t event, void *context)
+{
+  (void) buffer;
+  static_cast<std::vector<RBUF_WatermarkEvent_t> *>(context)->push_back(event);
+}
+
+} // namespace
+
+class RBUF_Watermark_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_InitEmpty(&rbuf, data, sizeof(data));
+    BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  }
+  // attributes
+  RBUF_t rbuf;
+  std::uint8_t data[16];
+  RBUF_Watermark_t watermark;
+  std::vector<RBUF_WatermarkEvent_t> events;
+
+  BUF_t buf;
+  std::uint8_t buf_data[16];
+};
+
+/**
+ * \brief High fires once on rising crossing, low once on falling crossing
+ */
+TEST_F(RBUF_Watermark_Fixture, watermark_001)
+{
+  ASSERT_TRUE(RBUF_SetWatermark(&rbuf, &watermark, 4, 10, Record, &events));
+
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "123456789", 9));
+  EXPECT_TRUE(events.empty());
+  EXPECT_TRUE(RBUF_WriteUint8(&rbuf, 'a'));
+  ASSERT_EQ(events.size(), 1U);
+  EXPECT_EQ(events[0], RBUF_WATERMARK_HIGH);
+  EXPECT_TRUE(RBUF_WriteUint8(&rbuf, 'b'));
+  EXPECT_EQ(events.size(), 1U); // No repeat above high
+
+  /* Hysteresis: between low and high nothing fires */
+  EXPECT_EQ(RBUF_ReadCopyRaw(&buf, &rbuf, 6), 6);
+  EXPECT_EQ(events.size(), 1U);
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "cd", 2));
+  EXPECT_EQ(events.size(), 1U);
+
+  EXPECT_EQ(RBUF_ReadCopyRaw(&buf, &rbuf, 3), 3);
+  EXPECT_EQ(RBUF_GetUsedSize(&rbuf), 4);
+  ASSERT_EQ(events.size(), 2U);
+  EXPECT_EQ(events[1], RBUF_WATERMARK_LOW);
+  (void) RBUF_ReadUint8(&rbuf);
+  EXPECT_EQ(events.size(), 2U);
+}
+
+/**
+ * \brief Commit, unchecked and jump over several thresholds at once
+ */
+TEST_F(RBUF_Watermark_Fixture, watermark_002)
+{
+  uint8_t value = 0;
+  ASSERT_TRUE(RBUF_SetWatermark(&rbuf, &watermark, 2, 8, Record, &events));
+
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 12));
+  EXPECT_EQ(events.size(), 1U);
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, 12));
+  EXPECT_EQ(events.size(), 2U);
+
+  for (int i = 0; i < 8; i++)
+  {
+    EXPECT_TRUE(RBUF_UncheckedWriteUint8(&rbuf, (uint8_t) i));
+  }
+  EXPECT_EQ(events.size(), 3U);
+  while (RBUF_UncheckedReadUint8(&rbuf, &value) == true)
+  {
+  }
+  ASSERT_EQ(events.size(), 4U);
+  EXPECT_EQ(events[3], RBUF_WATERMARK_LOW);
+
+  RBUF_ClearWatermark(&rbuf);
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 12));
+  EXPECT_EQ(events.size(), 4U);
+}
+
+/**
+ * \brief Buffer already above high starts in high state
+ */
+TEST_F(RBUF_Watermark_Fixture, watermark_003)
+{
+  EXPECT_TRUE(RBUF_WriteCommit(&rbuf, 12));
+  ASSERT_TRUE(RBUF_SetWatermark(&rbuf, &watermark, 4, 10, Record, &events));
+  EXPECT_TRUE(RBUF_WriteUint8(&rbuf, 0));
+  EXPECT_TRUE(events.empty());
+  EXPECT_TRUE(RBUF_ReadCommit(&rbuf, 13));
+  ASSERT_EQ(events.size(), 1U);
+  EXPECT_EQ(events[0], RBUF_WATERMARK_LOW);
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Watermark_Fixture, watermark_004)
+{
+  EXPECT_FALSE(RBUF_SetWatermark(nullptr, &watermark, 4, 10, Record, &events));
+  EXPECT_FALSE(RBUF_SetWatermark(&rbuf, nullptr, 4, 10, Record, &events));
+  EXPECT_FALSE(RBUF_SetWatermark(&rbuf, &watermark, 4, 10, nullptr, &events));
+  EXPECT_FALSE(RBUF_SetWatermark(&rbuf, &watermark, 10, 10, Record, &events));
+  EXPECT_FALSE(RBUF_SetWatermark(&rbuf, &watermark, 4, 16, Record, &events));
+  EXPECT_EQ(rbuf.watermark, nullptr);
+  RBUF_ClearWatermark(nullptr);
+}
+
+/**
+ * \brief Multi-byte writes signal once, with the whole value in the ring
+ */
+TEST_F(RBUF_Watermark_Fixture, watermark_005)
+{
+  std::vector<RBUF_size_t> used_sizes;
+  auto record_used = [](RBUF_t *buffer, RBUF_WatermarkEvent_t, void *context) {
+    static_cast<std::vector<RBUF_size_t> *>(context)->push_back(RBUF_GetUsedSize(buffer));
+  };
+  ASSERT_TRUE(RBUF_SetWatermark(&rbuf, &watermark, 4, 10, record_used, &used_sizes));
+
+  EXPECT_TRUE(RBUF_WriteString(&rbuf, "12345678", 8));
+  EXPECT_TRUE(RBUF_WriteUint32(&rbuf, 0x01020304U));
+  ASSERT_EQ(used_sizes.size(), 1U);
+  EXPECT_EQ(used_sizes[0], 12U);
+
+  EXPECT_EQ(RBUF_ReadCopyRaw(&buf, &rbuf, 10), 10U);
+  EXPECT_TRUE(RBUF_WriteUint16(&rbuf, 0x0506U));
+  EXPECT_TRUE(RBUF_WriteUint32(&rbuf, 0x0708090AU)); // Rolls over
+  EXPECT_TRUE(RBUF_WriteUint32(&rbuf, 0x0B0C0D0EU));
+  ASSERT_EQ(used_sizes.size(), 3U);
+  EXPECT_EQ(used_sizes[1], 2U); // Low
+  EXPECT_EQ(used_sizes[2], 12U);
+
+  BUF_InitEmpty(&buf, buf_data, sizeof(buf_data));
+  EXPECT_EQ(RBUF_ReadCopyRaw(&buf, &rbuf, 8), 8U);
+  EXPECT_EQ(0, memcmp(buf_data, "\x03\x04\x05\x06\x07\x08\x09\x0A", 8));
+}
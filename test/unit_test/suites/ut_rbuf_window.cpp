@@ -0,0 +1,143 @@
+//! \file ut_rbuf_window.cpp
+//! \brief Sliding window aggregates unit test
+//! \date  2026-10
+//! \author Nicolas Boutin
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <numeric>
+
+#include <gtest/gtest.h>
+
+extern "C" {
+#include "ring_buffer/ring_buffer_window.h"
+}
+
+using namespace testing;
+
+class RBUF_Window_Fixture : public ::testing::Test
+{
+protected:
+  void SetUp()
+  {
+    RBUF_WindowInit(&window, samples, min_slots, max_slots, CAPACITY);
+  }
+  // attributes
+  static constexpr uint8_t CAPACITY = 4;
+
+  RBUF_Window_t window;
+  int32_t samples[CAPACITY];
+  RBUF_size_t min_slots[CAPACITY];
+  RBUF_size_t max_slots[CAPACITY];
+};
+
+/**
+ * \brief Aggregates while filling and sliding
+ */
+TEST_F(RBUF_Window_Fixture, window_001)
+{
+  int32_t min = 0, max = 0, mean = 0;
+
+  EXPECT_FALSE(RBUF_WindowGetMin(&window, &min));
+  EXPECT_FALSE(RBUF_WindowGetMean(&window, &mean));
+
+  for (int32_t sample : {5, -3, 8, 2})
+  {
+    EXPECT_TRUE(RBUF_WindowPush(&window, sample));
+  }
+  EXPECT_EQ(RBUF_WindowGetCount(&window), CAPACITY);
+  EXPECT_EQ(RBUF_WindowGetSum(&window), 12);
+  EXPECT_TRUE(RBUF_WindowGetMin(&window, &min));
+  EXPECT_TRUE(RBUF_WindowGetMax(&window, &max));
+  EXPECT_TRUE(RBUF_WindowGetMean(&window, &mean));
+  EXPECT_EQ(min, -3);
+  EXPECT_EQ(max, 8);
+  EXPECT_EQ(mean, 3);
+
+  /* 5 and -3 slide out */
+  EXPECT_TRUE(RBUF_WindowPush(&window, 1));
+  EXPECT_TRUE(RBUF_WindowPush(&window, 4));
+  EXPECT_EQ(RBUF_WindowGetCount(&window), CAPACITY);
+  EXPECT_EQ(RBUF_WindowGetSum(&window), 15);
+  EXPECT_TRUE(RBUF_WindowGetMin(&window, &min));
+  EXPECT_TRUE(RBUF_WindowGetMax(&window, &max));
+  EXPECT_EQ(min, 1);
+  EXPECT_EQ(max, 8);
+
+  /* 8 slides out */
+  EXPECT_TRUE(RBUF_WindowPop(&window));
+  EXPECT_TRUE(RBUF_WindowGetMax(&window, &max));
+  EXPECT_EQ(max, 4);
+}
+
+/**
+ * \brief Aggregates match a full recomputation on random samples
+ */
+TEST_F(RBUF_Window_Fixture, window_002)
+{
+  std::deque<int32_t> reference;
+  int32_t min = 0, max = 0;
+
+  srand(34);
+  for (int i = 0; i < 1000; i++)
+  {
+    int32_t sample = (rand() % 2001) - 1000;
+    ASSERT_TRUE(RBUF_WindowPush(&window, sample));
+    reference.push_back(sample);
+    if (reference.size() > CAPACITY)
+    {
+      reference.pop_front();
+    }
+    ASSERT_TRUE(RBUF_WindowGetMin(&window, &min));
+    ASSERT_TRUE(RBUF_WindowGetMax(&window, &max));
+    EXPECT_EQ(min, *std::min_element(reference.begin(), reference.end()));
+    EXPECT_EQ(max, *std::max_element(reference.begin(), reference.end()));
+    EXPECT_EQ(RBUF_WindowGetSum(&window), std::accumulate(reference.begin(), reference.end(), int64_t(0)));
+  }
+}
+
+/**
+ * \brief Equal samples and drain
+ */
+TEST_F(RBUF_Window_Fixture, window_003)
+{
+  int32_t min = 0, max = 0;
+
+  for (int i = 0; i < 6; i++)
+  {
+    EXPECT_TRUE(RBUF_WindowPush(&window, 7));
+  }
+  EXPECT_TRUE(RBUF_WindowGetMin(&window, &min));
+  EXPECT_TRUE(RBUF_WindowGetMax(&window, &max));
+  EXPECT_EQ(min, 7);
+  EXPECT_EQ(max, 7);
+
+  while (RBUF_WindowPop(&window) == true)
+  {
+  }
+  EXPECT_EQ(RBUF_WindowGetCount(&window), 0);
+  EXPECT_EQ(RBUF_WindowGetSum(&window), 0);
+  EXPECT_FALSE(RBUF_WindowGetMax(&window, &max));
+}
+
+/**
+ * \brief Bad input parameters
+ */
+TEST_F(RBUF_Window_Fixture, window_004)
+{
+  int32_t value = 0;
+
+  EXPECT_FALSE(RBUF_WindowPush(nullptr, 1));
+  EXPECT_FALSE(RBUF_WindowPop(nullptr));
+  EXPECT_EQ(RBUF_WindowGetCount(nullptr), 0);
+  EXPECT_EQ(RBUF_WindowGetSum(nullptr), 0);
+  EXPECT_FALSE(RBUF_WindowGetMin(nullptr, &value));
+  EXPECT_TRUE(RBUF_WindowPush(&window, 1));
+  EXPECT_FALSE(RBUF_WindowGetMin(&window, nullptr));
+  EXPECT_FALSE(RBUF_WindowGetMax(&window, nullptr));
+  EXPECT_FALSE(RBUF_WindowGetMean(&window, nullptr));
+
+  RBUF_WindowInit(&window, samples, nullptr, max_slots, CAPACITY);
+  EXPECT_FALSE(RBUF_WindowPush(&window, 1));
+}